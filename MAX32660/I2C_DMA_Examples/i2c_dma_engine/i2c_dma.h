@@ -0,0 +1,138 @@
+/*******************************************************************************
+* Copyright (C) Maxim Integrated Products, Inc., All Rights Reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL MAXIM INTEGRATED BE LIABLE FOR ANY CLAIM, DAMAGES
+* OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*
+* Except as contained in this notice, the name of Maxim Integrated
+* Products, Inc. shall not be used except as stated in the Maxim Integrated
+* Products, Inc. Branding Policy.
+*
+* The mere transfer of this software does not imply any licenses
+* of trade secrets, proprietary technology, copyrights, patents,
+* trademarks, maskwork rights, or any other form of intellectual
+* property whatsoever. Maxim Integrated Products, Inc. retains all
+* ownership rights.
+ ******************************************************************************/
+
+/**
+ * @file    	i2c_dma.h
+ * @version		1.0
+ * Started:		03MAR2021
+ *
+ * @brief   	Queued I2C master transactions using DMA.
+ * @details 	Generalizes DMA_I2CWrite/DMA_I2CRead from the MAX30205 example. Each
+ *              request is a register transfer: a write of the register address and
+ *              an optional payload, then an optional read. The register address and
+ *              the payload are sent from the caller's buffers as two DMA segments
+ *              (the second through the channel's reload registers), so nothing is
+ *              copied. Requests are queued and the next one is started from the
+ *              interrupt that completes the previous one, so any number of
+ *              registers can be read or written without the CPU polling the bus.
+ *
+ * @code        static const uint8_t temp_reg = 0x00;
+ *              static uint8_t temp[2];
+ *              static i2c_dma_req_t read_temp = {
+ *                  .addr = 0x90, .reg = &temp_reg, .reg_len = 1,
+ *                  .rx_data = temp, .rx_len = 2, .callback = tempDone };
+ *
+ *              I2C_DMA_Init(MXC_I2C0, I2C_STD_MODE);
+ *              I2C_DMA_Submit(&read_temp);    // Returns at once, tempDone runs in the ISR
+ * @endcode
+ */
+
+#ifndef I2C_DMA_H_
+#define I2C_DMA_H_
+
+/***** Includes *****/
+#include <stdint.h>
+#include "i2c.h"
+#include "dma.h"
+#include "mxc_errors.h"
+
+/***** Definitions *****/
+#define I2C_DMA_MAX_RX      256     // Largest read the RX Control 1 rxcnt field allows
+
+typedef struct i2c_dma_req i2c_dma_req_t;
+
+/**
+ * @brief       Called from interrupt context when a request finishes.
+ *              The request is off the queue and may be submitted again from here.
+ * @param[in]   req: The finished request.
+ * @param[in]   error: E_NO_ERROR, or E_COMM_ERR if the slave did not acknowledge.
+ */
+typedef void (*i2c_dma_callback_fn)(i2c_dma_req_t *req, int error);
+
+/**
+ * @brief       One write-then-read transaction. All buffers belong to the caller and
+ *              must stay valid, and the request unchanged, until it completes.
+ */
+struct i2c_dma_req {
+    uint8_t addr;                   // 8-bit slave address, R/W bit ignored
+    const uint8_t *reg;             // Register address bytes, sent first
+    uint8_t reg_len;                // 0 if there is no register address
+    const uint8_t *tx_data;         // Payload sent after the register address
+    uint16_t tx_len;                // 0 for a register read
+    uint8_t *rx_data;               // Read after the write, with a new start
+    uint16_t rx_len;                // 0 for a write only, 1 to I2C_DMA_MAX_RX
+    i2c_dma_callback_fn callback;   // May be NULL
+    void *context;                  // Free for the caller
+    volatile int status;            // E_BUSY while queued, then the result
+    i2c_dma_req_t *next;            // Queue link, used by the engine
+};
+
+/***** Functions *****/
+/**
+ * @brief       Sets up the I2C master for DMA and acquires a TX and an RX DMA channel.
+ * @param[in]   i2c: MXC_I2C0 or MXC_I2C1.
+ * @param[in]   speed: Bus speed, see I2C_Init.
+ * @return      E_NO_ERROR, E_BAD_PARAM for an unknown module, E_NONE_AVAIL if no
+ *              DMA channels are free, or the error from I2C_Init.
+ * @pre         Call DMA_Init() first. Enables the I2C and DMA interrupts.
+ */
+int I2C_DMA_Init(mxc_i2c_regs_t *i2c, i2c_speed_t speed);
+
+/**
+ * @brief       Queues a request and returns without waiting. Safe to call from
+ *              interrupts, including a completion callback.
+ * @param[in]   req: Request to queue. It must not already be queued.
+ * @return      E_NO_ERROR, E_UNINITIALIZED before I2C_DMA_Init, E_NULL_PTR for a
+ *              missing buffer, or E_BAD_PARAM for an empty or too long transfer.
+ */
+int I2C_DMA_Submit(i2c_dma_req_t *req);
+
+/**
+ * @brief       Sleeps (LP_EnterSleepMode) until a submitted request finishes.
+ * @param[in]   req: Request passed to I2C_DMA_Submit.
+ * @return      The request's result, see i2c_dma_callback_fn.
+ */
+int I2C_DMA_Wait(i2c_dma_req_t *req);
+
+/**
+ * @brief       Submits a request and sleeps until it finishes.
+ * @return      The error from I2C_DMA_Submit, or the request's result.
+ */
+int I2C_DMA_Transfer(i2c_dma_req_t *req);
+
+/**
+ * @brief       Reports whether a transaction is queued or on the bus.
+ * @return      1 if busy, 0 if idle.
+ */
+int I2C_DMA_Busy(void);
+
+#endif /* I2C_DMA_H_ */
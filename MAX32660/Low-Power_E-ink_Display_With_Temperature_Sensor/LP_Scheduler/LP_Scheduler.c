@@ -0,0 +1,257 @@
+/*******************************************************************************
+* Copyright (C) Maxim Integrated Products, Inc., All rights Reserved.
+* 
+* This software is protected by copyright laws of the United States and
+* of foreign countries. This material may also be protected by patent laws
+* and technology transfer regulations of the United States and of foreign
+* countries. This software is furnished under a license agreement and/or a
+* nondisclosure agreement and may only be used or reproduced in accordance
+* with the terms of those agreements. Dissemination of this information to
+* any party or parties not specified in the license agreement and/or
+* nondisclosure agreement is expressly prohibited.
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL MAXIM INTEGRATED BE LIABLE FOR ANY CLAIM, DAMAGES
+* OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*
+* Except as contained in this notice, the name of Maxim Integrated
+* Products, Inc. shall not be used except as stated in the Maxim Integrated
+* Products, Inc. Branding Policy.
+*
+* The mere transfer of this software does not imply any licenses
+* of trade secrets, proprietary technology, copyrights, patents,
+* trademarks, maskwork rights, or any other form of intellectual
+* property whatsoever. Maxim Integrated Products, Inc. retains all
+* ownership rights.
+*******************************************************************************/
+/*
+*******************************************************************************
+* @file LP_Scheduler.c
+*
+* @version 1.0
+*
+* Started: 03/02/2021
+*
+* Updated: No current revisions
+*/
+
+#include <stddef.h>
+#include "mxc_errors.h"
+#include "LP_Scheduler.h"
+
+/***** Scheduler State *****/
+static sched_task_t *tasks[SCHED_MAX_TASKS];
+static uint8_t task_count;
+static uint8_t deep_locks;					//Deep sleep is allowed while this is 0
+static volatile uint8_t posts;				//A task was posted since the last pass picked them up
+
+/*
+ * @brief	Empties the task table, releases all deep sleep locks and starts the RTC
+ * @note       { Call once at boot, before any other Sched_ function }
+ */
+void Sched_Init(void)
+{
+	task_count = 0;
+	deep_locks = 0;
+	Sched_PortInit();
+}
+
+/*
+ * @brief	Registers a task with the scheduler
+ * @note       { Periodic tasks first run after delay milliseconds and then every period milliseconds. Tasks with a period of 0
+ * 			only run when scheduled with #Sched_RunIn, delay is ignored for them. The task struct must stay valid while the
+ * 			scheduler runs }
+ * @param[(in)] <task> { Task to add, name, run, ctx and period filled in }
+ * @param[(in)] <delay> { Milliseconds until the first run }
+ * @return     { E_NO_ERROR, or E_NONE_AVAIL when SCHED_MAX_TASKS tasks are already registered }
+ */
+int Sched_Add(sched_task_t *task, uint32_t delay)
+{
+	if (task_count >= SCHED_MAX_TASKS)
+	{
+		return E_NONE_AVAIL;
+	}
+
+	tasks[task_count++] = task;
+	task->pending = 0;
+	task->posted = 0;
+	task->awaiting = 0;
+	if (task->period != 0)
+	{
+		Sched_RunIn(task, delay);
+	}
+	return E_NO_ERROR;
+}
+
+/*
+ * @brief	Schedules the next run of a task, e.g. reading a sensor once its conversion is done
+ * @note       { Call from tasks (not interrupt handlers). A periodic task continues at its period from this run }
+ * @param[(in)] <task> { Registered task }
+ * @param[(in)] <delay> { Milliseconds from now }
+ */
+void Sched_RunIn(sched_task_t *task, uint32_t delay)
+{
+	task->due = Sched_Now() + delay;
+	task->pending = 1;
+}
+
+/*
+ * @brief	Stops a task until it is scheduled again with #Sched_RunIn
+ * @note       { Also drops a post that has not run yet and the #Sched_Expect wait }
+ */
+void Sched_Cancel(sched_task_t *task)
+{
+	task->pending = 0;
+	task->awaiting = 0;
+	task->posted = 0;
+}
+
+/*
+ * @brief	Marks a task as waiting for an interrupt to #Sched_Post it, e.g. when a DMA transfer completes
+ * @note       { Call from tasks, before starting the transfer (its callback may run before the call that starts it returns).
+ * 			Until the post, the scheduler sleeps in SLEEP, so peripherals and DMA keep running }
+ * @param[(in)] <task> { Registered task the interrupt will post }
+ */
+void Sched_Expect(sched_task_t *task)
+{
+	task->awaiting = 1;
+}
+
+/*
+ * @brief	Runs a task as soon as possible. The only scheduler function that may be called from interrupt handlers
+ * @note       { The next pass runs the task with its other due tasks. Posting again before it has run runs it once }
+ * @param[(in)] <task> { Registered task }
+ */
+void Sched_Post(sched_task_t *task)
+{
+	task->posted = 1;
+	task->awaiting = 0;
+	posts = 1;
+}
+
+/*
+ * @brief	For the port: tells whether a task was posted after the current pass picked up the posts
+ * @note       { #Sched_PortSleep checks this with interrupts masked, so a post just before sleeping is not slept through }
+ * @return     { Non-zero if a post is waiting }
+ */
+int Sched_Posted(void)
+{
+	return posts;
+}
+
+/*
+ * @brief	Keeps the scheduler out of deep sleep, e.g. while the UART console is in use
+ * @note       { Call from tasks (not interrupt handlers). Locks nest, deep sleep is allowed again once every lock is released }
+ */
+void Sched_DeepSleepLock(void)
+{
+	deep_locks++;
+}
+
+/*
+ * @brief	Releases a #Sched_DeepSleepLock
+ */
+void Sched_DeepSleepUnlock(void)
+{
+	if (deep_locks > 0)
+	{
+		deep_locks--;
+	}
+}
+
+/*
+ * @brief	One scheduler pass: runs every task that is due, then sleeps until the next task is due
+ * @note       { Periodic tasks keep their phase (due += period). A task that fell more than a period behind skips the runs it
+ * 			missed instead of running them back to back. The sleep mode is the deepest one allowed: DEEPSLEEP unless a
+ * 			#Sched_DeepSleepLock is held, a task waits for a #Sched_Post (#Sched_Expect) or the wait is shorter than
+ * 			SCHED_DEEPSLEEP_MIN_MS. With no task pending the CPU
+ * 			sleeps until some other interrupt (e.g. the push button) wakes it }
+ */
+void Sched_RunOnce(void)
+{
+	uint32_t now = Sched_Now();
+
+	//Posted tasks are due now
+	posts = 0;
+	for (uint8_t i = 0; i < task_count; i++)
+	{
+		if (tasks[i]->posted)
+		{
+			tasks[i]->posted = 0;
+			tasks[i]->due = now;
+			tasks[i]->pending = 1;
+		}
+	}
+
+	for (uint8_t i = 0; i < task_count; i++)
+	{
+		sched_task_t *task = tasks[i];
+		if (!task->pending || (int32_t)(now - task->due) < 0)
+		{
+			continue;
+		}
+
+		if (task->period != 0)
+		{
+			task->due += task->period;
+			if ((int32_t)(now - task->due) >= 0)
+			{
+				task->due = now + task->period;		//Skip missed runs
+			}
+		}
+		else
+		{
+			task->pending = 0;
+		}
+		task->run(task->ctx);
+	}
+
+	//Find the next task
+	now = Sched_Now();
+	int32_t wait = INT32_MAX;
+	uint8_t awaiting = 0;
+	for (uint8_t i = 0; i < task_count; i++)
+	{
+		if (tasks[i]->pending && (int32_t)(tasks[i]->due - now) < wait)
+		{
+			wait = (int32_t)(tasks[i]->due - now);
+		}
+		awaiting |= tasks[i]->awaiting;
+	}
+
+	if (wait <= 0)
+	{
+		return;			//A task became due while the others ran
+	}
+	if (wait == INT32_MAX)
+	{
+		wait = 0;		//Nothing scheduled, no alarm
+	}
+
+	if (deep_locks == 0 && !awaiting && (wait == 0 || wait >= SCHED_DEEPSLEEP_MIN_MS))
+	{
+		Sched_PortSleep(wait, SCHED_DEEPSLEEP);
+	}
+	else
+	{
+		Sched_PortSleep(wait, SCHED_SLEEP);
+	}
+}
+
+/*
+ * @brief	Runs the scheduler. Never returns
+ */
+void Sched_Run(void)
+{
+	while (1)
+	{
+		Sched_RunOnce();
+	}
+}
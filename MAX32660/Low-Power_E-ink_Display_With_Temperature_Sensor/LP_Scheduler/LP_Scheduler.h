@@ -0,0 +1,185 @@
+/*******************************************************************************
+* Copyright (C) Maxim Integrated Products, Inc., All rights Reserved.
+* 
+* This software is protected by copyright laws of the United States and
+* of foreign countries. This material may also be protected by patent laws
+* and technology transfer regulations of the United States and of foreign
+* countries. This software is furnished under a license agreement and/or a
+* nondisclosure agreement and may only be used or reproduced in accordance
+* with the terms of those agreements. Dissemination of this information to
+* any party or parties not specified in the license agreement and/or
+* nondisclosure agreement is expressly prohibited.
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL MAXIM INTEGRATED BE LIABLE FOR ANY CLAIM, DAMAGES
+* OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*
+* Except as contained in this notice, the name of Maxim Integrated
+* Products, Inc. shall not be used except as stated in the Maxim Integrated
+* Products, Inc. Branding Policy.
+*
+* The mere transfer of this software does not imply any licenses
+* of trade secrets, proprietary technology, copyrights, patents,
+* trademarks, maskwork rights, or any other form of intellectual
+* property whatsoever. Maxim Integrated Products, Inc. retains all
+* ownership rights.
+*******************************************************************************/
+/*	NOTE: Tickless task scheduler for the "Wearable Temperature Sensor LP" project. Tasks run at their own
+*	periods; between tasks the MAX32660 sleeps until the RTC alarm for the next one, in the deepest mode
+*	that is currently allowed. Nothing busy-waits.
+*
+*	LP_Scheduler.c holds the task table and the sleep policy and has no hardware access. The RTC and low
+*	power code it uses is in LP_Scheduler_RTC.c (see "Port" below), so the same scheduler can be run on a
+*	host against a simulated clock (tools/sched_sim.c).
+*******************************************************************************
+* @file LP_Scheduler.h
+*
+* @version 1.0
+*
+* Started: 03/02/2021
+*
+* Updated: No current revisions
+*/
+
+#ifndef LP_SCHEDULER_H_
+#define LP_SCHEDULER_H_
+
+/***** Includes *****/
+#include <stdint.h>
+
+/***** Scheduler Config *****/
+#define SCHED_MAX_TASKS				8		//Tasks that can be registered
+#define SCHED_DEEPSLEEP_MIN_MS		5		//Shorter waits use SLEEP, deep sleep entry and wake-up would cost more than they save
+
+/***** Types *****/
+typedef enum {
+	SCHED_SLEEP,				//CPU stopped, clocks and peripherals running (wakes on any interrupt)
+	SCHED_DEEPSLEEP				//System clock off, wakes on the RTC alarm or a GPIO
+} sched_mode_t;
+
+typedef struct sched_task {
+	const char *name;
+	void (*run)(void *ctx);
+	void *ctx;					//Passed to run
+	uint32_t period;			//Milliseconds between runs, 0 = runs once each time it is scheduled with #Sched_RunIn
+	uint32_t due;				//#Sched_Now time of the next run
+	uint8_t pending;			//due is valid
+	volatile uint8_t posted;	//Set by #Sched_Post, run on the next pass
+	volatile uint8_t awaiting;	//Set by #Sched_Expect until the task is posted
+} sched_task_t;
+
+/**
+ * @brief Tickless scheduler. Register tasks with #Sched_Add, then call #Sched_Run, which
+ * never returns. Each pass runs every task that is due, programs the RTC alarm for the
+ * next one and sleeps until it (or any other wake-up source) fires.
+ *
+ * Deep sleep stops the system clock, so UART output, SPI / I2C transfers and timers do not
+ * run in it. Code that needs them between tasks holds #Sched_DeepSleepLock; while any lock
+ * is held the scheduler uses SLEEP instead.
+ *
+ * Interrupt handlers hand work back with #Sched_Post, e.g. a DMA completion callback posting the
+ * task that uses the data. A task that starts such a transfer calls #Sched_Expect first, which
+ * keeps the scheduler in SLEEP until the post arrives.
+ *
+ * @code
+ *
+ * static void senseTask(void *ctx);
+ * static sched_task_t sense = { .name = "sense", .run = senseTask, .period = 7000 };
+ *
+ * int main(void)
+ * {
+ *	Sched_Init();
+ *	Sched_Add(&sense, 0);
+ *	Sched_Run();
+ * }
+ *
+ * @endcode
+ */
+
+/***** Functions *****/
+
+/**
+ * @brief	Empties the task table and starts the RTC. Call once at boot
+ */
+void Sched_Init(void);
+
+/**
+ * @brief	Registers a task, first run after delay milliseconds (periodic tasks) or when scheduled (period 0)
+ */
+int Sched_Add(sched_task_t *task, uint32_t delay);
+
+/**
+ * @brief	Runs a task once after delay milliseconds, replacing its next periodic run
+ */
+void Sched_RunIn(sched_task_t *task, uint32_t delay);
+
+/**
+ * @brief	Stops a task until it is scheduled again
+ */
+void Sched_Cancel(sched_task_t *task);
+
+/**
+ * @brief	Marks a task as waiting for #Sched_Post. The scheduler stays out of deep sleep until it is posted
+ */
+void Sched_Expect(sched_task_t *task);
+
+/**
+ * @brief	Runs a task on the next pass. Safe to call from interrupt handlers
+ */
+void Sched_Post(sched_task_t *task);
+
+/**
+ * @brief	Keeps the scheduler out of deep sleep until the matching #Sched_DeepSleepUnlock. Locks nest
+ */
+void Sched_DeepSleepLock(void);
+
+/**
+ * @brief	Releases a #Sched_DeepSleepLock
+ */
+void Sched_DeepSleepUnlock(void);
+
+/**
+ * @brief	Runs due tasks and sleeps until the next one. Returns after waking
+ */
+void Sched_RunOnce(void);
+
+/**
+ * @brief	Calls #Sched_RunOnce forever
+ */
+void Sched_Run(void);
+
+/**
+ * @brief	Non-zero if a task was posted that no pass has picked up yet. For #Sched_PortSleep
+ */
+int Sched_Posted(void);
+
+/***** Port (LP_Scheduler_RTC.c) *****/
+
+/**
+ * @brief	Starts the RTC and enables its alarm as a wake-up source
+ */
+void Sched_PortInit(void);
+
+/**
+ * @brief	Milliseconds since #Sched_PortInit, wraps after 49 days
+ */
+uint32_t Sched_Now(void);
+
+/**
+ * @brief	Whole seconds since #Sched_PortInit
+ */
+uint32_t Sched_Seconds(void);
+
+/**
+ * @brief	Sleeps for at most ms milliseconds (0 = no alarm) in the given mode. Returns when the alarm or another interrupt wakes the CPU
+ */
+void Sched_PortSleep(uint32_t ms, sched_mode_t mode);
+
+#endif /* LP_SCHEDULER_H_ */
@@ -0,0 +1,182 @@
+/*******************************************************************************
+* Copyright (C) Maxim Integrated Products, Inc., All rights Reserved.
+* 
+* This software is protected by copyright laws of the United States and
+* of foreign countries. This material may also be protected by patent laws
+* and technology transfer regulations of the United States and of foreign
+* countries. This software is furnished under a license agreement and/or a
+* nondisclosure agreement and may only be used or reproduced in accordance
+* with the terms of those agreements. Dissemination of this information to
+* any party or parties not specified in the license agreement and/or
+* nondisclosure agreement is expressly prohibited.
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL MAXIM INTEGRATED BE LIABLE FOR ANY CLAIM, DAMAGES
+* OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*
+* Except as contained in this notice, the name of Maxim Integrated
+* Products, Inc. shall not be used except as stated in the Maxim Integrated
+* Products, Inc. Branding Policy.
+*
+* The mere transfer of this software does not imply any licenses
+* of trade secrets, proprietary technology, copyrights, patents,
+* trademarks, maskwork rights, or any other form of intellectual
+* property whatsoever. Maxim Integrated Products, Inc. retains all
+* ownership rights.
+*******************************************************************************/
+/*
+*******************************************************************************
+* @file LP_Scheduler_RTC.c
+*
+* @version 1.0
+*
+* Started: 03/02/2021
+*
+* Updated: No current revisions
+*/
+
+#include "Max32660.h"
+#include "board.h"
+#include "mxc_errors.h"
+#include "NVIC_table.h"
+#include "lp.h"
+#include "rtc.h"
+#include "uart.h"
+#include "LP_Scheduler.h"
+
+/***** Port Config *****/
+#define SCHED_RTC_HZ			256			//RTC sub-second counter rate (SSEC and the RSSA alarm)
+#define SCHED_MAX_SLEEP_MS		3600000		//Longest single alarm, longer waits are split by Sched_RunOnce
+
+/***** Port State *****/
+static volatile int sched_wake;				//RTC alarm fired since the alarm was last programmed
+
+/*
+ * @brief	RTC interrupt. Clears the alarm flags and stops the sub-second alarm, which would otherwise repeat
+ */
+static void schedAlarm(void)
+{
+	int flags = RTC_GetFlags();
+
+	if (flags & MXC_F_RTC_CTRL_ALSF)
+	{
+		RTC_ClearFlags(MXC_F_RTC_CTRL_ALSF);
+		RTC_DisableSubsecondInterrupt(MXC_RTC);
+	}
+	if (flags & MXC_F_RTC_CTRL_ALDF)
+	{
+		RTC_ClearFlags(MXC_F_RTC_CTRL_ALDF);
+	}
+	sched_wake = 1;
+}
+
+/*
+ * @brief	Starts the RTC from 0 and enables its alarm as an interrupt and a deep sleep wake-up source
+ * @note       { The RTC is never restarted after this, #Sched_Now and #Sched_Seconds count from here }
+ */
+void Sched_PortInit(void)
+{
+	sys_cfg_rtc_t sys_cfg;
+	sys_cfg.tmr = MXC_TMR0;
+
+	while(RTC_Init(MXC_RTC, 0, 0, &sys_cfg) == E_BUSY);
+	while(RTC_EnableRTCE(MXC_RTC) == E_BUSY);
+	NVIC_SetVector(RTC_IRQn, schedAlarm);
+	NVIC_EnableIRQ(RTC_IRQn);
+	LP_EnableRTCAlarmWakeup();
+}
+
+/*
+ * @brief	Reads one RTC counter, retrying while the RTC is busy synchronizing
+ */
+static uint32_t rtcRead(int (*get)(mxc_rtc_regs_t *rtc))
+{
+	int v;
+	while((v = get(MXC_RTC)) < 0);
+	return (uint32_t)v;
+}
+
+/*
+ * @brief	Time since #Sched_PortInit
+ * @note       { Seconds are read again after the sub-second count so a rollover between the two reads is not missed }
+ * @return     { Milliseconds, with the 1/256 s resolution of the RTC }
+ */
+uint32_t Sched_Now(void)
+{
+	uint32_t sec, ssec;
+
+	do
+	{
+		sec = rtcRead(RTC_GetSecond);
+		ssec = rtcRead(RTC_GetSubSecond);
+	} while (sec != rtcRead(RTC_GetSecond));
+
+	return (sec * 1000) + ((ssec * 1000) / SCHED_RTC_HZ);
+}
+
+/*
+ * @brief	Whole seconds since #Sched_PortInit, e.g. for timestamping readings
+ */
+uint32_t Sched_Seconds(void)
+{
+	return rtcRead(RTC_GetSecond);
+}
+
+/*
+ * @brief	Programs the RTC sub-second alarm and sleeps until it (or another interrupt) wakes the CPU
+ * @note       { The sub-second alarm counts up from RSSA at 256 Hz and fires when it overflows, so a wait of n ticks is
+ * 			RSSA = 0 - n. Deep sleep gets the same preparation the project always used (band gap, VCORE POR and block
+ * 			detect off, RAM retention on, fast wake-up). Interrupts are masked between checking sched_wake (and
+ * 			#Sched_Posted) and WFI so an alarm or post that happens in between still wakes the CPU }
+ * @param[(in)] <ms> { Longest time to sleep, 0 = until some other interrupt }
+ * @param[(in)] <mode> { SCHED_SLEEP or SCHED_DEEPSLEEP }
+ */
+void Sched_PortSleep(uint32_t ms, sched_mode_t mode)
+{
+	sched_wake = 0;
+	if (ms != 0)
+	{
+		if (ms > SCHED_MAX_SLEEP_MS)
+		{
+			ms = SCHED_MAX_SLEEP_MS;
+		}
+		uint32_t ticks = ((ms * SCHED_RTC_HZ) + 999) / 1000;
+
+		while(RTC_DisableSubsecondInterrupt(MXC_RTC) == E_BUSY);
+		while(RTC_SetSubsecondAlarm(MXC_RTC, 0 - ticks) == E_BUSY);
+		while(RTC_EnableSubsecondInterrupt(MXC_RTC) == E_BUSY);
+	}
+
+	if (mode == SCHED_DEEPSLEEP)
+	{
+		//Wait for serial transactions to complete
+		while(UART_PrepForSleep(MXC_UART_GET_UART(CONSOLE_UART)) != E_NO_ERROR);
+
+		LP_DisableBandGap();
+		LP_DisableVCorePORSignal();
+		LP_EnableRamRetReg();
+		LP_DisableBlockDetect();
+		LP_EnableFastWk();
+	}
+
+	__disable_irq();
+	if (!sched_wake && !Sched_Posted())
+	{
+		if (mode == SCHED_DEEPSLEEP)
+		{
+			LP_EnterDeepSleepMode();
+		}
+		else
+		{
+			LP_EnterSleepMode();
+		}
+	}
+	__enable_irq();
+}
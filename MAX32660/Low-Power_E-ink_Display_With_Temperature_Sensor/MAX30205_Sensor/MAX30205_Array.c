@@ -0,0 +1,242 @@
+/*******************************************************************************
+* Copyright (C) Maxim Integrated Products, Inc., All rights Reserved.
+* 
+* This software is protected by copyright laws of the United States and
+* of foreign countries. This material may also be protected by patent laws
+* and technology transfer regulations of the United States and of foreign
+* countries. This software is furnished under a license agreement and/or a
+* nondisclosure agreement and may only be used or reproduced in accordance
+* with the terms of those agreements. Dissemination of this information to
+* any party or parties not specified in the license agreement and/or
+* nondisclosure agreement is expressly prohibited.
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL MAXIM INTEGRATED BE LIABLE FOR ANY CLAIM, DAMAGES
+* OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*
+* Except as contained in this notice, the name of Maxim Integrated
+* Products, Inc. shall not be used except as stated in the Maxim Integrated
+* Products, Inc. Branding Policy.
+*
+* The mere transfer of this software does not imply any licenses
+* of trade secrets, proprietary technology, copyrights, patents,
+* trademarks, maskwork rights, or any other form of intellectual
+* property whatsoever. Maxim Integrated Products, Inc. retains all
+* ownership rights.
+*******************************************************************************/
+/*
+*******************************************************************************
+* @file MAX30205_Array.c
+*
+* @version 1.0
+*
+* Started: 03/02/2021
+*
+* Updated: No current revisions
+*/
+
+#include "MAX30205_Array.h"
+
+/***** Pass State *****/
+static max30205_array_t *pass_array;	//Array the running pass goes over (NULL = idle). One pass at a time, it owns pass_req
+static uint8_t pass_read;				//0 = one-shot commands, 1 = temperature reads
+static uint8_t pass_last;				//Sensor whose request ends the pass
+static i2c_dma_req_t pass_req[MAX30205_ARRAY_MAX];	//One request per sensor, all queued when the pass starts
+static uint8_t pass_rx[MAX30205_ARRAY_MAX][2];		//Temperature registers, MSB first (written by DMA)
+static const uint8_t pass_regTemp = MAX30205_REG_TEMP;
+static const uint8_t pass_regConfig = MAX30205_REG_CONFIG;
+static const uint8_t pass_config = MAX30205_CONFIG_SHUTDOWN | MAX30205_CONFIG_ONESHOT;
+
+/*
+ * @brief	Ends the pass and runs the array's callback
+ */
+static void passEnd(max30205_array_t *array)
+{
+	pass_array = NULL;
+	if (array->callback != NULL)
+	{
+		array->callback(array, (array->failed != 0) ? E_COMM_ERR : E_NO_ERROR);
+	}
+}
+
+/*
+ * @brief	Completion callback of each request in a pass. The DMA engine has already started the next one
+ * @note       { Runs in the I2C / DMA interrupt. A sensor that does not answer is marked in array->failed and keeps its last
+ * reading; the pass goes on. The request of sensor pass_last ends the pass }
+ * @param[(in)] <req> { Request of sensor req - pass_req }
+ * @param[(in)] <error> { Result of the transfer with that sensor }
+ */
+static void passDone(i2c_dma_req_t *req, int error)
+{
+	max30205_array_t *array = pass_array;
+	uint8_t i = req - pass_req;
+
+	if (error != E_NO_ERROR)
+	{
+		array->failed |= 1ul << i;
+	}
+	else if (pass_read)
+	{
+		array->q8[i] = MAX30205_Q8(pass_rx[i]);
+	}
+
+	array->next = i + 1;
+	if (i == pass_last)
+	{
+		passEnd(array);
+	}
+}
+
+/*
+ * @brief	Starts a pass over every sensor of the array: queues one request per sensor, so the engine runs them back to back
+ * from its interrupts
+ * @note       { Interrupts are held off while queueing, so no request can end the pass before pass_last is known. If a request
+ * cannot be queued, the pass ends with the one before it and every sensor not reached is marked in array->failed }
+ * @return     { E_NO_ERROR once started, E_BUSY if a pass is running, E_NONE_AVAIL if the array is empty, or the error from
+ * #MAX30205_Submit for the first sensor }
+ */
+static int passStart(max30205_array_t *array, uint8_t read, void (*callback)(max30205_array_t *array, int error))
+{
+	uint32_t primask;
+	int error = E_NO_ERROR;
+
+	if (pass_array != NULL)
+	{
+		return E_BUSY;
+	}
+	if (array->count == 0)
+	{
+		return E_NONE_AVAIL;
+	}
+
+	pass_array = array;
+	pass_read = read;
+	pass_last = array->count - 1;
+	array->next = 0;
+	array->failed = 0;
+	array->callback = callback;
+
+	primask = __get_PRIMASK();
+	__disable_irq();
+	for (uint8_t i = 0; i < array->count; i++)
+	{
+		i2c_dma_req_t *req = &pass_req[i];
+
+		req->addr = array->addr[i];
+		req->reg = read ? &pass_regTemp : &pass_regConfig;
+		req->reg_len = 1;
+		req->tx_data = &pass_config;
+		req->tx_len = read ? 0 : 1;
+		req->rx_data = pass_rx[i];
+		req->rx_len = read ? sizeof(pass_rx[i]) : 0;
+		req->callback = passDone;
+
+		error = MAX30205_Submit(req);
+		if (error != E_NO_ERROR)
+		{
+			for (uint8_t j = i; j < array->count; j++)
+			{
+				array->failed |= 1ul << j;		//The pass ends before these sensors, so they have no fresh result
+			}
+			if (i == 0)
+			{
+				pass_array = NULL;
+				break;
+			}
+			pass_last = i - 1;
+			if (pass_req[pass_last].status != E_BUSY)
+			{
+				passEnd(array);			//Already done (blocking driver), nothing is left to end the pass
+			}
+			error = E_NO_ERROR;
+			break;
+		}
+	}
+	__set_PRIMASK(primask);
+	return error;
+}
+
+/*
+ * @brief	Reads a 16 bit register during the probe, sleeping through the transfer
+ * @return     { E_NO_ERROR, or E_COMM_ERR if nothing answered at addr }
+ */
+static int probeRead(uint8_t addr, uint8_t reg, uint16_t *value)
+{
+	MAX30205_Wait();
+	int error = MAX30205_RegTransferAsync(addr, reg, NULL, 0, value, NULL);
+	if (error != E_NO_ERROR)
+	{
+		return error;
+	}
+	return MAX30205_Wait();
+}
+
+/*
+ * @brief	Finds every MAX30205 on the bus. An address from MAX30205_ADDR_FIRST to MAX30205_ADDR_LAST is added to the array
+ * when its T_HYST and T_OS registers read back their power-on values, so other devices sharing the address range are
+ * only read, never written
+ * @note       { Blocking, sleeps through each transfer (about 1 ms per address at 100 kHz). Only the sensors found are then
+ * written, to put them into shutdown mode as #MAX30205_ArrayConvertAsync needs; one that does not take the write has its
+ * bit set in array->failed. Thresholds changed since power-up hide a sensor from the probe. Call once after
+ * #MAX30205_I2CSetup, while no pass is running }
+ * @param[(out)] <array> { Filled with the addresses found, in address order }
+ * @return     { Number of sensors found }
+ */
+uint8_t MAX30205_ArrayProbe(max30205_array_t *array)
+{
+	uint8_t config = MAX30205_CONFIG_SHUTDOWN;
+	uint16_t hyst;
+	uint16_t os;
+
+	array->count = 0;
+	array->failed = 0;
+	for (uint16_t addr = MAX30205_ADDR_FIRST; addr <= MAX30205_ADDR_LAST; addr += 2)
+	{
+		if (probeRead(addr, MAX30205_REG_THYST, &hyst) == E_NO_ERROR && hyst == MAX30205_THYST_POR &&
+			probeRead(addr, MAX30205_REG_TOS, &os) == E_NO_ERROR && os == MAX30205_TOS_POR)
+		{
+			array->addr[array->count++] = addr;
+		}
+	}
+
+	for (uint8_t i = 0; i < array->count; i++)
+	{
+		MAX30205_Wait();
+		if (MAX30205_RegTransferAsync(array->addr[i], MAX30205_REG_CONFIG, &config, 1, NULL, NULL) != E_NO_ERROR ||
+			MAX30205_Wait() != E_NO_ERROR)
+		{
+			array->failed |= 1ul << i;
+		}
+	}
+	return array->count;
+}
+
+/*
+ * @brief	Starts a one-shot conversion on every sensor of the array, back to back
+ * @note       { All conversions overlap, so every result can be read MAX30205_CONVERSION_MS after the callback }
+ * @param[(in)] <callback> { Called from interrupt context after the last command (may be NULL). error is E_COMM_ERR if any
+ * sensor did not answer, see array->failed }
+ * @return     { E_NO_ERROR once started, E_BUSY if a pass is running, E_NONE_AVAIL if the array is empty }
+ */
+int MAX30205_ArrayConvertAsync(max30205_array_t *array, void (*callback)(max30205_array_t *array, int error))
+{
+	return passStart(array, 0, callback);
+}
+
+/*
+ * @brief	Reads the temperature register of every sensor of the array into array->q8, back to back
+ * @note       { Readings of sensors that did not answer keep their last value and have their bit set in array->failed }
+ * @param[(in)] <callback> { Called from interrupt context after the last read (may be NULL) }
+ * @return     { E_NO_ERROR once started, E_BUSY if a pass is running, E_NONE_AVAIL if the array is empty }
+ */
+int MAX30205_ArrayReadAsync(max30205_array_t *array, void (*callback)(max30205_array_t *array, int error))
+{
+	return passStart(array, 1, callback);
+}
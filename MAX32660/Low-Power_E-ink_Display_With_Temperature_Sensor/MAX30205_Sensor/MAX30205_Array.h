@@ -0,0 +1,123 @@
+/*******************************************************************************
+* Copyright (C) Maxim Integrated Products, Inc., All rights Reserved.
+* 
+* This software is protected by copyright laws of the United States and
+* of foreign countries. This material may also be protected by patent laws
+* and technology transfer regulations of the United States and of foreign
+* countries. This software is furnished under a license agreement and/or a
+* nondisclosure agreement and may only be used or reproduced in accordance
+* with the terms of those agreements. Dissemination of this information to
+* any party or parties not specified in the license agreement and/or
+* nondisclosure agreement is expressly prohibited.
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL MAXIM INTEGRATED BE LIABLE FOR ANY CLAIM, DAMAGES
+* OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*
+* Except as contained in this notice, the name of Maxim Integrated
+* Products, Inc. shall not be used except as stated in the Maxim Integrated
+* Products, Inc. Branding Policy.
+*
+* The mere transfer of this software does not imply any licenses
+* of trade secrets, proprietary technology, copyrights, patents,
+* trademarks, maskwork rights, or any other form of intellectual
+* property whatsoever. Maxim Integrated Products, Inc. retains all
+* ownership rights.
+*******************************************************************************/
+/*	NOTE: Sensor array manager for MAX30205 patches with more than one sensor on the I2C bus. The three
+*	address pins of the MAX30205 give 32 addresses (0x80 - 0xBE, 8 bit write address). The bus is probed
+*	once for every address that answers, then each measurement is two passes over the sensors found: the
+*	one-shot commands back to back, so all conversions overlap in one MAX30205_CONVERSION_MS window, and
+*	the temperature reads back to back. A pass queues one request per sensor on the I2C DMA engine
+*	(i2c_dma.h), which starts each from the interrupt that ends the one before, so the CPU only takes part
+*	at the start and the end of a pass.
+*******************************************************************************
+* @file MAX30205_Array.h
+*
+* @version 1.0
+*
+* Started: 03/02/2021
+*
+* Updated: No current revisions
+*/
+
+#ifndef MAX30205_ARRAY_H_
+#define MAX30205_ARRAY_H_
+
+/***** Includes *****/
+#include <stdint.h>
+#include "MAX30205_Sensor.h"
+
+/***** Definitions *****/
+#define MAX30205_ADDR_FIRST		0x80	//Lowest MAX30205 address (8 bit write address)
+#define MAX30205_ADDR_LAST		0xBE	//Highest MAX30205 address
+#define MAX30205_ARRAY_MAX		32		//Sensors one bus can hold, one per address
+
+/***** Types *****/
+typedef struct max30205_array {
+	uint8_t count;								//Sensors found by #MAX30205_ArrayProbe
+	uint8_t addr[MAX30205_ARRAY_MAX];			//8 bit write address of each sensor
+	int16_t q8[MAX30205_ARRAY_MAX];				//Last reading of each sensor, degrees Celsius * 256
+	volatile uint32_t failed;					//Bit n set: sensor n did not answer in the last pass
+	volatile uint8_t next;						//Sensor the running pass is at
+	void (*callback)(struct max30205_array *array, int error);	//Completion callback of the running pass
+} max30205_array_t;
+
+/**
+ * @brief Reads many MAX30205 sensors with one conversion window. With the scheduler (see
+ * LP_Scheduler.h) the two passes are tasks posted from the completion callbacks:
+ *
+ * @code
+ *
+ * static max30205_array_t patch;
+ *
+ * static void converting(max30205_array_t *array, int error)
+ * {
+ *	Sched_Post(&task_wait);				//task_wait: Sched_RunIn(&task_read, MAX30205_CONVERSION_MS)
+ * }
+ *
+ * static void readingsIn(max30205_array_t *array, int error)
+ * {
+ *	Sched_Post(&task_show);				//patch.q8[0 .. patch.count - 1], skip the bits set in patch.failed
+ * }
+ *
+ * MAX30205_I2CSetup();
+ * MAX30205_ArrayProbe(&patch);			//Also puts every sensor found into shutdown mode
+ *
+ * //Sense task
+ * Sched_Expect(&task_wait);
+ * MAX30205_ArrayConvertAsync(&patch, converting);
+ *
+ * //Read task
+ * Sched_Expect(&task_show);
+ * MAX30205_ArrayReadAsync(&patch, readingsIn);
+ *
+ * @endcode
+ */
+
+/***** Functions *****/
+
+/**
+ * @brief	Finds every MAX30205 on the bus by reading its threshold registers, then puts each one found into shutdown mode,
+ * ready for one-shot conversions. Returns the number found
+ */
+uint8_t MAX30205_ArrayProbe(max30205_array_t *array);
+
+/**
+ * @brief	Starts a one-shot conversion on every sensor, back to back. The callback runs from interrupt context after the last command
+ */
+int MAX30205_ArrayConvertAsync(max30205_array_t *array, void (*callback)(max30205_array_t *array, int error));
+
+/**
+ * @brief	Reads the temperature of every sensor into array->q8, back to back. The callback runs from interrupt context after the last read
+ */
+int MAX30205_ArrayReadAsync(max30205_array_t *array, void (*callback)(max30205_array_t *array, int error));
+
+#endif /* MAX30205_ARRAY_H_ */
@@ -41,6 +41,10 @@
 *	
 *	Also note that this project is setup using te MAX32660 EVkit in Maxim Toolchain in the Eclipse IDE.
 *	The MAX30205 sensor values are being read from the MAX30205 Ev-Kit.
+*
+*	Register transfers are requests to the queued I2C DMA engine in i2c_dma.c / i2c_dma.h. Those two files
+*	are a copy of I2C_DMA_Examples/i2c_dma_engine (the projects are copied into Eclipse one at a time), so
+*	fix the engine there and copy it over unchanged.
 *******************************************************************************/
 /*
 * @file MAX30205_Sensor.c
@@ -54,23 +58,234 @@
 
 #include "MAX30205_Sensor.h"
 
-/***** Device Register Addresses *****/
-static uint8_t INTIALIZE_SLEEP[] = {0x01, 0x01};					//Config register address and sleep-mode configuration data 
-//static uint8_t CONFIGURATION_REGISTER_ADDR[] = {0x01, 0x00};		//Config register address and active mode setup
-static uint8_t CONFIGURATION_ONESHOT[] = {0x01, 0x81};				//Config register address and one-shot configuration data
-static uint8_t TEMPERATURE_REGISTER_ADDR[] = {0x00};				//Temperature register address
+/***** Variables *****/
+i2c_req_t req;							//I2C Device structure
+volatile int i2c_flag;
+volatile int i2c_flag1;
 
+/***** Register Transfer State *****/
+static int i2c_dma_ready;				//1 once I2C_DMA_Init has set up I2C_MASTER, 0 = requests run on the blocking I2C driver
+static i2c_dma_req_t reg_req;			//Request of #MAX30205_RegTransferAsync, status is E_BUSY while it is queued
+static uint8_t reg_addr;				//Register address, sent from here by DMA
+static uint8_t reg_tx[2];				//Data bytes written after the address
+static uint8_t reg_rx[2];				//Register value, MSB first
+static uint16_t *reg_out;				//Where the register value goes
+static void (*reg_cb)(int error);		//Completion callback of reg_req
 
 /**
  * @brief	Initialize I2C protocol for MAX32660 microcontroller. Must be called before any read or write commands in project. Only needs to be called once in main function. Initialzies P0_2 (SCL) and P0_3 (SDA)
+ * @note       { Sets up the queued DMA engine (i2c_dma.c, the copy of I2C_DMA_Examples/i2c_dma_engine) on I2C_MASTER. If it
+ * cannot get two DMA channels, requests fall back to the blocking I2C driver, see #MAX30205_Submit }
+ *
+ * @return     { E_NO_ERROR, or E_NONE_AVAIL if no DMA channels were free (register transfers then block) }
  */
-void MAX30205_I2CSetup(void){
+int MAX30205_I2CSetup(void){
 	const sys_cfg_i2c_t sys_i2c_cfg = NULL; /* No system specific configuration needed. */
 
-	//Setup the I2CM
-	I2C_Shutdown(I2C_MASTER);
-	I2C_Init(I2C_MASTER, I2C_STD_MODE, &sys_i2c_cfg);
-	NVIC_EnableIRQ(I2C1_IRQn);
+	DMA_Init();
+	int error = I2C_DMA_Init(I2C_MASTER, I2C_STD_MODE);
+	i2c_dma_ready = (error == E_NO_ERROR);
+	if (!i2c_dma_ready)
+	{
+		//Setup the I2CM for the blocking driver
+		I2C_Shutdown(I2C_MASTER);
+		I2C_Init(I2C_MASTER, I2C_STD_MODE, &sys_i2c_cfg);
+	}
+	return(error);
+}
+
+/**
+ * @brief	Queues a request on I2C_MASTER, see i2c_dma.h for its fields
+ * @note       { Goes to #I2C_DMA_Submit, so it returns at once and the callback runs from interrupt context. Without DMA channels
+ * the request runs on the blocking I2C driver instead (register address and payload up to 3 bytes) and the callback runs
+ * before the call returns }
+ * @param[(in)] <req> { Request to queue, must not be queued already. Buffers must stay valid until it completes }
+ * @return     { E_NO_ERROR once queued, or the error from #I2C_DMA_Submit }
+ */
+int MAX30205_Submit(i2c_dma_req_t *req)
+{
+	if (i2c_dma_ready)
+	{
+		return I2C_DMA_Submit(req);
+	}
+
+	uint8_t tx[3];
+	int len = req->reg_len + req->tx_len;
+	int error = E_NO_ERROR;
+
+	if (len > sizeof(tx))
+	{
+		return E_BAD_PARAM;
+	}
+	for (int i = 0; i < len; i++)
+	{
+		tx[i] = (i < req->reg_len) ? req->reg[i] : req->tx_data[i - req->reg_len];
+	}
+
+	if (len != 0 && I2C_MasterWrite(I2C_MASTER, req->addr, tx, len, (req->rx_len != 0) ? READ_ACKNOWLEDGE : WRITE_ACKNOWLEDGE) != len)
+	{
+		error = E_COMM_ERR;
+	}
+	else if (req->rx_len != 0 && I2C_MasterRead(I2C_MASTER, req->addr, req->rx_data, req->rx_len, WRITE_ACKNOWLEDGE) != req->rx_len)
+	{
+		error = E_COMM_ERR;
+	}
+	req->status = error;
+	if (req->callback != NULL)
+	{
+		req->callback(req, error);
+	}
+	return E_NO_ERROR;
+}
+
+/*
+ * @brief	Completion callback of reg_req: stores the value read and runs the caller's callback
+ * @param[(in)] <error> { E_NO_ERROR, or E_COMM_ERR if the sensor did not acknowledge }
+ */
+static void regDone(i2c_dma_req_t *req, int error)
+{
+	if (error == E_NO_ERROR && reg_out != NULL)
+	{
+		*reg_out = ((uint16_t)reg_rx[0] << 8) | reg_rx[1];
+	}
+	if (reg_cb != NULL)
+	{
+		reg_cb(error);
+	}
+}
+
+/**
+ * @brief	Starts a register transfer with any sensor on the bus: writes the register address and len data bytes, then reads the
+ * 16 bit register if out is set
+ * @note       { The transfer functions below use it with SLAVE_ADDR. It is one request to the DMA engine, queued behind any others
+ * on the bus (e.g. a #MAX30205_ArrayReadAsync pass). Without DMA channels the callback runs before the call returns }
+ * @param[(in)] <addr> { 8 bit write address of the sensor (SLAVE_ADDR for the EV kit, see #MAX30205_ArrayProbe for the others) }
+ * @param[(in)] <reg> { Register address }
+ * @param[(in)] <data> { Bytes written after the address, MSB first. Copied, so it may live on the caller's stack }
+ * @param[(in)] <len> { Number of data bytes (0 - 2) }
+ * @param[(out)] <out> { Register value read back (NULL = write only). Must stay valid until the callback runs }
+ * @param[(in)] <callback> { Called from interrupt context when the transfer has ended (may be NULL) }
+ * @return     { E_NO_ERROR once started, E_BUSY if the previous transfer has not ended, or the error from #MAX30205_Submit }
+ */
+int MAX30205_RegTransferAsync(uint8_t addr, uint8_t reg, const uint8_t *data, uint8_t len, uint16_t *out, void (*callback)(int error))
+{
+	if (reg_req.status == E_BUSY)
+	{
+		return E_BUSY;
+	}
+	if (len > sizeof(reg_tx))
+	{
+		return E_BAD_PARAM;
+	}
+
+	reg_addr = reg;
+	memcpy(reg_tx, data, len);
+	reg_out = out;
+	reg_cb = callback;
+
+	reg_req.addr = addr;
+	reg_req.reg = &reg_addr;
+	reg_req.reg_len = 1;
+	reg_req.tx_data = reg_tx;
+	reg_req.tx_len = len;
+	reg_req.rx_data = reg_rx;
+	reg_req.rx_len = (out != NULL) ? sizeof(reg_rx) : 0;
+	reg_req.callback = regDone;
+	return MAX30205_Submit(&reg_req);
+}
+
+/**
+ * @brief	Starts reading a 16 bit register. Returns as soon as the transfer has started
+ *
+ * @param 	[(in)] <reg> { Register address, e.g. MAX30205_REG_TEMP }
+ * @param 	[(out)] <out> { Register value, MSB first on the bus. Must stay valid until the callback runs }
+ * @param 	[(in)] <callback> { Called from interrupt context with the result when the transfer has ended (may be NULL) }
+ *
+ * @return     { E_NO_ERROR once started, E_BUSY if a transfer is already in flight }
+ */
+int MAX30205_ReadReg16Async(uint8_t reg, uint16_t *out, void (*callback)(int error)){
+	return(MAX30205_RegTransferAsync(SLAVE_ADDR, reg, NULL, 0, out, callback));
+}
+
+/**
+ * @brief	Starts writing a 16 bit register (T_HYST, T_OS). Returns as soon as the transfer has started
+ *
+ * @param 	[(in)] <reg> { Register address }
+ * @param 	[(in)] <value> { Register value }
+ * @param 	[(in)] <callback> { Called from interrupt context with the result when the transfer has ended (may be NULL) }
+ *
+ * @return     { E_NO_ERROR once started, E_BUSY if a transfer is already in flight }
+ */
+int MAX30205_WriteReg16Async(uint8_t reg, uint16_t value, void (*callback)(int error)){
+	uint8_t data[2] = { value >> 8, value & 0xFF };
+	return(MAX30205_RegTransferAsync(SLAVE_ADDR, reg, data, sizeof(data), NULL, callback));
+}
+
+/**
+ * @brief	Starts writing the 8 bit configuration register. Returns as soon as the transfer has started
+ *
+ * @param 	[(in)] <reg> { Register address, MAX30205_REG_CONFIG }
+ * @param 	[(in)] <value> { Register value, e.g. MAX30205_CONFIG_SHUTDOWN }
+ * @param 	[(in)] <callback> { Called from interrupt context with the result when the transfer has ended (may be NULL) }
+ *
+ * @return     { E_NO_ERROR once started, E_BUSY if a transfer is already in flight }
+ */
+int MAX30205_WriteReg8Async(uint8_t reg, uint8_t value, void (*callback)(int error)){
+	return(MAX30205_RegTransferAsync(SLAVE_ADDR, reg, &value, 1, NULL, callback));
+}
+
+/**
+ * @brief	Sleeps the core until the register transfer in flight has ended. Returns immediately if nothing is in flight.
+ *
+ * @note       { The core sits in SLEEP mode, so the DMA controller and I2C peripheral keep running }
+ *
+ * @return     { Result of the last transfer: E_NO_ERROR, or E_COMM_ERR if the sensor did not acknowledge }
+ */
+int MAX30205_Wait(void){
+	return(I2C_DMA_Wait(&reg_req));
+}
+
+/**
+ * @brief	Reads a 16 bit register, sleeping until the value is in
+ *
+ * @param 	[(in)] <reg> { Register address, e.g. MAX30205_REG_TEMP }
+ * @param 	[(out)] <out> { Register value }
+ * @note       { Waits for a transfer already in flight first }
+ *
+ * @return     { E_NO_ERROR, or E_COMM_ERR if the sensor did not acknowledge (out is left unchanged) }
+ */
+int MAX30205_ReadReg16(uint8_t reg, uint16_t *out){
+	MAX30205_Wait();
+	MAX30205_ReadReg16Async(reg, out, NULL);
+	return(MAX30205_Wait());
+}
+
+/**
+ * @brief	Writes a 16 bit register, sleeping until the transfer has ended
+ *
+ * @param 	[(in)] <reg> { Register address }
+ * @param 	[(in)] <value> { Register value }
+ *
+ * @return     { E_NO_ERROR, or E_COMM_ERR if the sensor did not acknowledge }
+ */
+int MAX30205_WriteReg16(uint8_t reg, uint16_t value){
+	MAX30205_Wait();
+	MAX30205_WriteReg16Async(reg, value, NULL);
+	return(MAX30205_Wait());
+}
+
+/**
+ * @brief	Writes the 8 bit configuration register, sleeping until the transfer has ended
+ *
+ * @param 	[(in)] <reg> { Register address, MAX30205_REG_CONFIG }
+ * @param 	[(in)] <value> { Register value }
+ *
+ * @return     { E_NO_ERROR, or E_COMM_ERR if the sensor did not acknowledge }
+ */
+int MAX30205_WriteReg8(uint8_t reg, uint8_t value){
+	MAX30205_Wait();
+	MAX30205_WriteReg8Async(reg, value, NULL);
+	return(MAX30205_Wait());
 }
 
 /**
@@ -92,66 +307,134 @@ double MAX30205_CtoF(double Celsius){
 
 /**
  * @brief	Place MAX30205 into sleep mode -- Sensor will stop continuous temperature measurments. Sensor waits for One-Shot signal
- * 
+ *
  * @note       { Make sure #MAX30205_I2CSETUP has been called at start of program before reading or writing any data. }
+ *
+ * @return     { E_NO_ERROR, or E_COMM_ERR if the sensor did not acknowledge }
  */
-void MAX30205_TempSenseSleep(void){
-	if(I2C_MasterWrite(I2C_MASTER, SLAVE_ADDR, INTIALIZE_SLEEP, BYTES_WRITTEN, WRITE_ACKNOWLEDGE) != BYTES_WRITTEN){
-		printf("ERROR WRITING CONFIGURATION REGISTER AND ENTERING SLEEP MODE\n");
-	}		
+int MAX30205_TempSenseSleep(void){
+	return(MAX30205_WriteReg8(MAX30205_REG_CONFIG, MAX30205_CONFIG_SHUTDOWN));
 }
 
 /**
  * @brief	Send a One-Shot signal to calculate a new temperature. Sensor must be placed into Sleep mode first.
- * 
+ *
  * @note       { Make sure #MAX30205_I2CSETUP has been called before reading or writing any data. Also, make sure #MAX30205_TempSenseSleep has been called to put device into sleep mode}
+ *
+ * @return     { E_NO_ERROR, or E_COMM_ERR if the sensor did not acknowledge }
  */
-void MAX30205_OneShotSense(void){
-	int error;
-	if((error = I2C_MasterWrite(I2C_MASTER, SLAVE_ADDR, CONFIGURATION_ONESHOT, BYTES_WRITTEN, WRITE_ACKNOWLEDGE)) != BYTES_WRITTEN){
-		printf("ERROR WRITING CONFIGURATION REGISTER\n");
-	}
+int MAX30205_OneShotSense(void){
+	return(MAX30205_WriteReg8(MAX30205_REG_CONFIG, MAX30205_CONFIG_SHUTDOWN | MAX30205_CONFIG_ONESHOT));
+}
+
+/**
+ * @brief	Starts a one-shot conversion. Returns as soon as the configuration write has started
+ *
+ * @param 	[(in)] <callback> { Called from interrupt context once the command has been written (may be NULL). The result can be
+ * read MAX30205_CONVERSION_MS after that; in between the micro can sleep, including deep sleep }
+ * @note       { Make sure #MAX30205_TempSenseSleep has been called to put device into sleep mode }
+ *
+ * @return     { E_NO_ERROR once started, E_BUSY if a transfer is already in flight }
+ */
+int MAX30205_OneShotSenseAsync(void (*callback)(int error)){
+	return(MAX30205_WriteReg8Async(MAX30205_REG_CONFIG, MAX30205_CONFIG_SHUTDOWN | MAX30205_CONFIG_ONESHOT, callback));
 }
 
 /**
  * @brief	Read value stored in temperature register
  *
- * @note       { Make sure #MAX30205_I2CSETUP has been called before reading or writing any data. }
+ * @note       { Make sure #MAX30205_I2CSETUP has been called before reading or writing any data. Use #MAX30205_TempReadQ8 to get
+ * the error code }
  *
- * @return	Value of temperature in degrees Farenheit
+ * @return	Value of temperature in degrees Celsius (0 if the sensor did not answer)
  */
 double MAX30205_TempRead(void){
-	int error;
-	int WRITE_SIZE = 2;
-	uint8_t data[1];
-	//Read Temperature
-	if((error = I2C_MasterWrite(I2C_MASTER, SLAVE_ADDR, TEMPERATURE_REGISTER_ADDR, BYTES_READ, READ_ACKNOWLEDGE)) != BYTES_READ){
-		printf("ERROR READING ACCESSING TEMPERATURE REGISTER\n");
-	}
-	if ((error = I2C_MasterRead(I2C_MASTER, SLAVE_ADDR, data, BYTES_WRITTEN, WRITE_ACKNOWLEDGE)) != BYTES_WRITTEN){
-		printf("ERROR READING TEMPERATURE DATA\n");
+	uint8_t data[2] = { 0, 0 };
+	uint16_t raw;
+	if (MAX30205_ReadReg16(MAX30205_REG_TEMP, &raw) == E_NO_ERROR){
+		data[0] = raw >> 8;
+		data[1] = raw & 0xFF;
 	}
-	double f = MAX30205_TempCalc(data);
-	return (f);
+	return(MAX30205_TempCalc(data));
 }
 
 /**
  * @brief	Convert temperature register reading into degrees Celsius
  *
  * @param 	[(in)] <data> { data array holding temperature register reading }
- * @note       { Make sure #MAX30205_TempRead has been called before calculating temperature }
+ * @note       { Make sure #MAX30205_TempRead has been called before calculating temperature. Same value as #MAX30205_Q8 / 256, use
+ * the fixed-point functions to avoid double arithmetic }
  *
- * @return	Temperature reading in degrees Farenheit
+ * @return	Temperature reading in degrees Celsius
  */
 double MAX30205_TempCalc(uint8_t *data){
-	double Celsius = data[0];
-	int val;
-	double power = -1;
-	for(int j=7;j>0;j--){
-		val = (data[1]>>j) & 1;
-		Celsius += val*(pow(2,power));
-		power--;
+	return(MAX30205_Q8(data) / 256.0);
+}
+
+/**
+ * @brief	Read the temperature register as a raw fixed-point value
+ *
+ * @param 	[(out)] <q8> { Temperature in degrees Celsius * 256, left unchanged if the sensor did not answer }
+ * @note       { Make sure #MAX30205_I2CSETUP has been called before reading or writing any data. No floating point is used, convert
+ * the result with #MAX30205_Q8ToCentiC or #MAX30205_Q8ToCentiF }
+ *
+ * @return     { E_NO_ERROR, or E_COMM_ERR if the sensor did not acknowledge }
+ */
+int MAX30205_TempReadQ8(int16_t *q8){
+	uint16_t raw;
+	int error = MAX30205_ReadReg16(MAX30205_REG_TEMP, &raw);
+	if (error == E_NO_ERROR){
+		*q8 = (int16_t)raw;
 	}
-	return(Celsius);
+	return(error);
+}
+
+/**
+ * @brief	Starts reading the temperature register as a raw fixed-point value. Returns as soon as the transfer has started
+ *
+ * @param 	[(out)] <q8> { Temperature in degrees Celsius * 256. Must stay valid until the callback runs }
+ * @param 	[(in)] <callback> { Called from interrupt context with the result when q8 has been written (may be NULL) }
+ *
+ * @return     { E_NO_ERROR once started, E_BUSY if a transfer is already in flight }
+ */
+int MAX30205_TempReadQ8Async(int16_t *q8, void (*callback)(int error)){
+	return(MAX30205_ReadReg16Async(MAX30205_REG_TEMP, (uint16_t *)q8, callback));
+}
+
+/**
+ * @brief	Combine the two temperature register bytes into a Q8 value
+ *
+ * @param 	[(in)] <data> { Temperature register, MSB first }
+ * @note       { The register is two's complement with 1 LSB = 1/256 degree Celsius (normal data format) }
+ *
+ * @return	Temperature in degrees Celsius * 256
+ */
+int16_t MAX30205_Q8(const uint8_t *data){
+	return((int16_t)((data[0] << 8) | data[1]));
+}
+
+/**
+ * @brief	Convert a Q8 temperature to hundredths of a degree Celsius
+ *
+ * @param 	[(in)] <q8> { Temperature in degrees Celsius * 256 }
+ * @note       { q8 * 100 / 256 = q8 * 25 / 64, truncated toward zero like the double conversion }
+ *
+ * @return	Temperature in hundredths of a degree Celsius
+ */
+int16_t MAX30205_Q8ToCentiC(int16_t q8){
+	return((int16_t)(((int32_t)q8 * 25) / 64));
 }
 
+/**
+ * @brief	Convert a Q8 temperature to hundredths of a degree Fahrenheit
+ *
+ * @param 	[(in)] <q8> { Temperature in degrees Celsius * 256 }
+ * @note       { F * 100 = q8 / 256 * 9 / 5 * 100 + 3200 = (q8 * 45 + 3200 * 64) / 64, truncated toward zero. The result is exact;
+ * the double path (#MAX30205_TempCalc, #MAX30205_CtoF) can come out one hundredth low where F * 100 is a whole number, since
+ * e.g. 33.8 has no exact double }
+ *
+ * @return	Temperature in hundredths of a degree Fahrenheit
+ */
+int16_t MAX30205_Q8ToCentiF(int16_t q8){
+	return((int16_t)((((int32_t)q8 * 45) + (3200 * 64)) / 64));
+}
@@ -57,8 +57,12 @@
 #include <stdio.h>
 #include <stdint.h>
 #include <string.h>
-#include <math.h>
 #include "i2c.h"
+#include "dma.h"
+#include "lp.h"
+#include "mxc_errors.h"
+#include "NVIC_table.h"
+#include "i2c_dma.h"
 
 /***** I2C Declirations *****/
 #define I2C_MASTER	    MXC_I2C1		//Set master to P0_2 and P0_3. Change to MXC_I2C0 to setup master as P0_8 (SCL) and P0_9 (SDA)
@@ -71,9 +75,20 @@
 #define	READ_ACKNOWLEDGE	1			//MAX32660 continues transmission after read or write, keeps MAX30205 selected
 #define	WRITE_ACKNOWLEDGE	0			//MAX32660 ends transmission after read or write
 
-i2c_req_t req;							//I2C Device structure
-volatile int i2c_flag;
-volatile int i2c_flag1;
+/***** MAX30205 Registers *****/
+#define MAX30205_REG_TEMP			0x00	//Temperature, 16 bit two's complement, 1/256 degree Celsius per LSB
+#define MAX30205_REG_CONFIG			0x01	//Configuration, 8 bit
+#define MAX30205_REG_THYST			0x02	//Hysteresis, 16 bit
+#define MAX30205_REG_TOS			0x03	//Overtemperature shutdown, 16 bit
+#define MAX30205_THYST_POR			0x4B00	//T_HYST after power-up (75 degrees Celsius)
+#define MAX30205_TOS_POR			0x5000	//T_OS after power-up (80 degrees Celsius)
+#define MAX30205_CONFIG_SHUTDOWN	0x01	//Stop continuous conversions
+#define MAX30205_CONFIG_ONESHOT		0x80	//Start one conversion while shut down
+#define MAX30205_CONVERSION_MS		50		//One-shot conversion time (datasheet maximum), counted from the end of the config write
+
+extern i2c_req_t req;					//I2C Device structure (defined in MAX30205_Sensor.c)
+extern volatile int i2c_flag;
+extern volatile int i2c_flag1;
 
 
 /**
@@ -115,7 +130,7 @@ volatile int i2c_flag1;
  *     	MAX30205_OneShotSense();
  * 
  *     	//Give time to make a new reading
- *     	TMR_Delay(MXC_TMR0, MSEC(50), NULL);
+ *     	TMR_Delay(MXC_TMR0, MSEC(MAX30205_CONVERSION_MS), NULL);
  * 
  *     	//Convert to Fahrenheit and display new value on screen
  *     	double Celsius = MAX30205_TempRead();
@@ -136,7 +151,52 @@ volatile int i2c_flag1;
 /*
  * @brief	Initialize I2C protocol for MAX32660 microcontroller. Must be called before any read or write commands in project. Only needs to be called once in main function. Initialzies P0_2 (SCL) and P0_3 (SDA)
  */
-void MAX30205_I2CSetup(void);
+int MAX30205_I2CSetup(void);
+
+/*
+ * @brief	Read a 16 bit register, sleeping until the value is in. Returns E_NO_ERROR or E_COMM_ERR
+ */
+int MAX30205_ReadReg16(uint8_t reg, uint16_t *out);
+
+/*
+ * @brief	Write a 16 bit register (T_HYST, T_OS), sleeping until the transfer has ended
+ */
+int MAX30205_WriteReg16(uint8_t reg, uint16_t value);
+
+/*
+ * @brief	Write the 8 bit configuration register, sleeping until the transfer has ended
+ */
+int MAX30205_WriteReg8(uint8_t reg, uint8_t value);
+
+/*
+ * @brief	Queue a request on I2C_MASTER with the DMA engine (i2c_dma.h), or run it on the blocking driver if setup found no DMA channels
+ */
+int MAX30205_Submit(i2c_dma_req_t *req);
+
+/*
+ * @brief	Start a register write and optional 16 bit read with the sensor at addr. The transfer functions below use SLAVE_ADDR
+ */
+int MAX30205_RegTransferAsync(uint8_t addr, uint8_t reg, const uint8_t *data, uint8_t len, uint16_t *out, void (*callback)(int error));
+
+/*
+ * @brief	Start reading a 16 bit register with DMA. The callback runs from interrupt context when the value is in
+ */
+int MAX30205_ReadReg16Async(uint8_t reg, uint16_t *out, void (*callback)(int error));
+
+/*
+ * @brief	Start writing a 16 bit register with DMA. The callback runs from interrupt context when the transfer has ended
+ */
+int MAX30205_WriteReg16Async(uint8_t reg, uint16_t value, void (*callback)(int error));
+
+/*
+ * @brief	Start writing the 8 bit configuration register with DMA
+ */
+int MAX30205_WriteReg8Async(uint8_t reg, uint8_t value, void (*callback)(int error));
+
+/*
+ * @brief	Sleep until the register transfer in flight has ended. Returns its result
+ */
+int MAX30205_Wait(void);
 
 /*
  * @brief	Convert temperature reading from Celsius to Farenheit
@@ -146,12 +206,18 @@ double MAX30205_CtoF(double Celsius);
 /*
  * @brief	Place MAX30205 into sleep mode -- Sensor will stop continuous temperature measurments. Sensor waits for One-Shot signal
  */
-void MAX30205_TempSenseSleep(void);
+int MAX30205_TempSenseSleep(void);
 
 /*
  * @brief	Send a One-Shot signal to calculate a new temperature. Sensor must be placed into Sleep mode first
  */
-void MAX30205_OneShotSense(void);
+int MAX30205_OneShotSense(void);
+
+/*
+ * @brief	Start a one-shot conversion with DMA. The callback runs from interrupt context once the command is written; the
+ * result is ready MAX30205_CONVERSION_MS later
+ */
+int MAX30205_OneShotSenseAsync(void (*callback)(int error));
 
 /*
  * @brief	Read value stored in temperature register
@@ -163,4 +229,29 @@ double MAX30205_TempRead(void);
  */
 double MAX30205_TempCalc(uint8_t *data);
 
+/*
+ * @brief	Read the temperature register as degrees Celsius * 256 (Q8), without floating point. Returns E_NO_ERROR or E_COMM_ERR
+ */
+int MAX30205_TempReadQ8(int16_t *q8);
+
+/*
+ * @brief	Start reading the temperature register (Q8) with DMA. The callback runs from interrupt context when q8 is valid
+ */
+int MAX30205_TempReadQ8Async(int16_t *q8, void (*callback)(int error));
+
+/*
+ * @brief	Combine the two temperature register bytes (MSB first) into a Q8 value
+ */
+int16_t MAX30205_Q8(const uint8_t *data);
+
+/*
+ * @brief	Convert a Q8 temperature to hundredths of a degree Celsius
+ */
+int16_t MAX30205_Q8ToCentiC(int16_t q8);
+
+/*
+ * @brief	Convert a Q8 temperature to hundredths of a degree Fahrenheit
+ */
+int16_t MAX30205_Q8ToCentiF(int16_t q8);
+
 #endif /* MAX30205_Sensor_H_ */
@@ -0,0 +1,368 @@
+/*******************************************************************************
+* Copyright (C) Maxim Integrated Products, Inc., All Rights Reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL MAXIM INTEGRATED BE LIABLE FOR ANY CLAIM, DAMAGES
+* OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*
+* Except as contained in this notice, the name of Maxim Integrated
+* Products, Inc. shall not be used except as stated in the Maxim Integrated
+* Products, Inc. Branding Policy.
+*
+* The mere transfer of this software does not imply any licenses
+* of trade secrets, proprietary technology, copyrights, patents,
+* trademarks, maskwork rights, or any other form of intellectual
+* property whatsoever. Maxim Integrated Products, Inc. retains all
+* ownership rights.
+ ******************************************************************************/
+
+/**
+ * @file    	i2c_dma.c
+ * @version		1.0
+ * Started:		03MAR2021
+ *
+ * @brief   	Queued I2C master transactions using DMA, see i2c_dma.h.
+ * @details 	A request runs in up to two phases, each a bus transaction of its own
+ *              as in DMA_I2CWrite/DMA_I2CRead:
+ *              1) Write: the slave address goes into the TX FIFO, then the TX channel
+ *                 sends the register address and the payload. The phase ends on the
+ *                 stop condition.
+ *              2) Read: the RX channel stores rx_len bytes. The phase ends once the
+ *                 stop condition has been seen and the channel has stored the last
+ *                 byte, whichever interrupt comes second.
+ *              The interrupt that ends the last phase completes the request, starts
+ *              the next one in the queue and then runs the callback.
+ */
+
+/***** Includes *****/
+#include <stddef.h>
+#include "i2c_dma.h"
+#include "NVIC_table.h"
+#include "lp.h"
+
+/***** Definitions *****/
+#define WAIT_STOP       0x01    // Stop condition still to come
+#define WAIT_RX         0x02    // RX channel still to store the last byte
+#define I2C_DMA_INT_EN  (MXC_F_I2C_INT_EN0_STOP | MXC_F_I2C_INT_EN0_ADDR_NACK_ERR | MXC_F_I2C_INT_EN0_DATA_ERR)
+
+/***** Globals *****/
+static mxc_i2c_regs_t *i2c_bus;                 // NULL until I2C_DMA_Init
+static int dma_tx = -1, dma_rx = -1;
+static i2c_dma_req_t *queue_head;               // Request on the bus
+static i2c_dma_req_t *queue_tail;
+static volatile uint8_t wait_events;            // WAIT_ bits of the running phase
+static volatile uint8_t reading;                // 1 in the read phase
+static volatile int phase_error;
+
+/***** Functions *****/
+/**
+ * @brief       Starts the write phase. The register address and the payload are two
+ *              DMA segments: the channel moves on to the reload registers when the
+ *              first runs out, so the caller's buffers are sent as they are.
+ */
+static void startWrite(i2c_dma_req_t *req)
+{
+    const uint8_t *first = req->reg_len ? req->reg : req->tx_data;
+    unsigned int first_len = req->reg_len ? req->reg_len : req->tx_len;
+
+    reading = 0;
+    i2c_bus->int_fl0 = i2c_bus->int_fl0;
+    DMA_Stop(dma_tx);
+
+    // Note: For Write transactions, the slave address should be loaded before starting the channel.
+    i2c_bus->fifo = (req->addr & ~(0x1));
+    DMA_SetSrcDstCnt(dma_tx, (void *)first, 0, first_len);
+    if (req->reg_len && req->tx_len) {
+        DMA_SetReload(dma_tx, (void *)req->tx_data, 0, req->tx_len);
+    } else {
+        DMA_SetReload(dma_tx, 0, 0, 0);    // A zero count leaves reload off
+    }
+    DMA_Start(dma_tx);
+
+    wait_events = WAIT_STOP;
+    i2c_bus->int_en0 = I2C_DMA_INT_EN;
+    i2c_bus->master_ctrl |= MXC_F_I2C_MASTER_CTRL_START;
+    i2c_bus->master_ctrl |= MXC_F_I2C_MASTER_CTRL_STOP;
+}
+
+/**
+ * @brief       Starts the read phase into req->rx_data.
+ */
+static void startRead(i2c_dma_req_t *req)
+{
+    reading = 1;
+    i2c_bus->int_fl0 = i2c_bus->int_fl0;
+    i2c_bus->rx_ctrl1 = (req->rx_len & 0xFF);  // 0 reads 256 bytes
+    DMA_Stop(dma_rx);
+    DMA_SetSrcDstCnt(dma_rx, 0, req->rx_data, req->rx_len);
+    DMA_Start(dma_rx);
+    i2c_bus->fifo = (req->addr | 0x1);
+
+    wait_events = WAIT_STOP | WAIT_RX;
+    i2c_bus->int_en0 = I2C_DMA_INT_EN;
+    i2c_bus->master_ctrl |= MXC_F_I2C_MASTER_CTRL_START;
+    i2c_bus->master_ctrl |= MXC_F_I2C_MASTER_CTRL_STOP;
+}
+
+/**
+ * @brief       Starts the first phase of a request.
+ */
+static void startRequest(i2c_dma_req_t *req)
+{
+    phase_error = E_NO_ERROR;
+    if (req->reg_len || req->tx_len) {
+        startWrite(req);
+    } else {
+        startRead(req);
+    }
+}
+
+/**
+ * @brief       Takes the finished request off the queue, starts the next one so the bus
+ *              stays busy, then reports the result.
+ */
+static void finishRequest(int error)
+{
+    i2c_dma_req_t *req = queue_head;
+
+    i2c_bus->int_en0 = 0;
+    DMA_Stop(dma_tx);
+    DMA_Stop(dma_rx);
+
+    queue_head = req->next;
+    if (queue_head == NULL) {
+        queue_tail = NULL;
+    }
+    req->next = NULL;
+    req->status = error;
+
+    if (queue_head != NULL) {
+        startRequest(queue_head);
+    }
+    if (req->callback != NULL) {
+        req->callback(req, error);
+    }
+}
+
+/**
+ * @brief       Records a bus event. Once the running phase has all its events, starts
+ *              the read phase or finishes the request.
+ * @param[in]   event: WAIT_STOP or WAIT_RX.
+ */
+static void phaseEvent(uint8_t event)
+{
+    wait_events &= ~event;
+    if (wait_events != 0) {
+        return;
+    }
+
+    if (phase_error == E_NO_ERROR && !reading && queue_head->rx_len != 0) {
+        startRead(queue_head);
+    } else {
+        finishRequest(phase_error);
+    }
+}
+
+/**
+ * @brief       I2C interrupt. A NACK fails the request; it still ends on the stop
+ *              condition so the next request starts on an idle bus.
+ */
+static void I2C_DMA_IRQHandler(void)
+{
+    uint32_t flags = i2c_bus->int_fl0;
+    i2c_bus->int_fl0 = flags;
+
+    if (queue_head == NULL) {
+        return;
+    }
+    if (flags & (MXC_F_I2C_INT_FL0_ADDR_NACK_ERR | MXC_F_I2C_INT_FL0_DATA_ERR)) {
+        phase_error = E_COMM_ERR;
+        wait_events &= ~WAIT_RX;    // The RX channel will not finish
+        i2c_bus->master_ctrl |= MXC_F_I2C_MASTER_CTRL_STOP;
+    }
+    if (flags & MXC_F_I2C_INT_FL0_STOP) {
+        phaseEvent(WAIT_STOP);
+    }
+}
+
+/**
+ * @brief       RX channel callback, run by DMA_Handler once the last byte is stored.
+ */
+static void rxDone(int ch, int error)
+{
+    if (queue_head != NULL && reading && (wait_events & WAIT_RX)) {
+        phaseEvent(WAIT_RX);
+    }
+}
+
+/**
+ * @brief       RX DMA channel interrupt.
+ */
+static void DMA_RX_IRQHandler(void)
+{
+    DMA_Handler(dma_rx);
+}
+
+/*****************************************************************************/
+int I2C_DMA_Init(mxc_i2c_regs_t *i2c, i2c_speed_t speed)
+{
+    const sys_cfg_i2c_t sys_i2c_cfg = NULL; // No system specific configuration needed.
+    dma_reqsel_t tx_reqsel, rx_reqsel;
+    IRQn_Type i2c_irq;
+    int err;
+
+    if (i2c == MXC_I2C0) {
+        tx_reqsel = DMA_REQSEL_I2C0TX;
+        rx_reqsel = DMA_REQSEL_I2C0RX;
+        i2c_irq = I2C0_IRQn;
+    } else if (i2c == MXC_I2C1) {
+        tx_reqsel = DMA_REQSEL_I2C1TX;
+        rx_reqsel = DMA_REQSEL_I2C1RX;
+        i2c_irq = I2C1_IRQn;
+    } else {
+        return E_BAD_PARAM;
+    }
+
+    if (dma_tx < 0) {
+        dma_tx = DMA_AcquireChannel();
+    }
+    if (dma_rx < 0) {
+        dma_rx = DMA_AcquireChannel();
+    }
+    if (dma_tx < 0 || dma_rx < 0) {
+        return E_NONE_AVAIL;
+    }
+
+    I2C_Shutdown(i2c);
+    if ((err = I2C_Init(i2c, speed, &sys_i2c_cfg)) != E_NO_ERROR) {
+        return err;
+    }
+    i2c->dma |= MXC_F_I2C_DMA_TX_EN | MXC_F_I2C_DMA_RX_EN; // Enable DMA stream on the I2C Bus
+    i2c->int_en0 = 0;
+
+    // Set the TX and RX thresholds to 1. Avoids FIFO overflow/underflow
+    i2c->tx_ctrl0 = (0x1 << MXC_F_I2C_TX_CTRL0_TX_THRESH_POS);
+    i2c->rx_ctrl0 = (0x1 << MXC_F_I2C_RX_CTRL0_RX_THRESH_POS);
+    i2c->ctrl |= MXC_F_I2C_CTRL_MST;   //Set Master Control bit
+
+    DMA_ConfigChannel(  dma_tx,                 //ch
+                    DMA_PRIO_HIGH,              //prio
+                    tx_reqsel,                  //reqsel
+                    1,                          //reqwait_en
+                    DMA_TIMEOUT_4_CLK,          //tosel
+                    DMA_PRESCALE_DISABLE,       //pssel
+                    DMA_WIDTH_BYTE,             //srcwd
+                    1,                          //srcinc_en
+                    DMA_WIDTH_BYTE,             //dstwd
+                    0,                          //dstinc_en
+                    1,                          //burst_size (bytes-1)
+                    0,                          //chdis_inten
+                    0                           //ctz_inten
+                    );
+
+    DMA_ConfigChannel(  dma_rx,                 //ch
+                    DMA_PRIO_MEDHIGH,           //prio
+                    rx_reqsel,                  //reqsel
+                    1,                          //reqwait_en
+                    DMA_TIMEOUT_4_CLK,          //tosel
+                    DMA_PRESCALE_DISABLE,       //pssel
+                    DMA_WIDTH_BYTE,             //srcwd
+                    0,                          //srcinc_en
+                    DMA_WIDTH_BYTE,             //dstwd
+                    1,                          //dstinc_en
+                    1,                          //burst_size (bytes-1)
+                    1,                          //chdis_inten
+                    0                           //ctz_inten
+                    );
+    DMA_SetCallback(dma_rx, rxDone);
+    DMA_EnableInterrupt(dma_rx);
+
+    i2c_bus = i2c;
+    queue_head = NULL;
+    queue_tail = NULL;
+
+    NVIC_SetVector((IRQn_Type)(DMA0_IRQn + dma_rx), DMA_RX_IRQHandler);
+    NVIC_EnableIRQ((IRQn_Type)(DMA0_IRQn + dma_rx));
+    NVIC_SetVector(i2c_irq, I2C_DMA_IRQHandler);
+    NVIC_EnableIRQ(i2c_irq);
+    return E_NO_ERROR;
+}
+
+/*****************************************************************************/
+int I2C_DMA_Submit(i2c_dma_req_t *req)
+{
+    uint32_t primask;
+
+    if (i2c_bus == NULL) {
+        return E_UNINITIALIZED;
+    }
+    if (req == NULL || (req->reg_len && req->reg == NULL) || (req->tx_len && req->tx_data == NULL)
+            || (req->rx_len && req->rx_data == NULL)) {
+        return E_NULL_PTR;
+    }
+    if (req->rx_len > I2C_DMA_MAX_RX || (req->reg_len + req->tx_len + req->rx_len) == 0) {
+        return E_BAD_PARAM;
+    }
+
+    req->status = E_BUSY;
+    req->next = NULL;
+
+    // Callbacks submit from the I2C and DMA interrupts, so keep their masking as it was
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if (queue_tail != NULL) {
+        queue_tail->next = req;
+        queue_tail = req;
+    } else {
+        queue_head = req;
+        queue_tail = req;
+        startRequest(req);
+    }
+    __set_PRIMASK(primask);
+    return E_NO_ERROR;
+}
+
+/*****************************************************************************/
+int I2C_DMA_Wait(i2c_dma_req_t *req)
+{
+    // Interrupts stay masked between the check and sleep; a pending one still wakes the core
+    __disable_irq();
+    while (req->status == E_BUSY) {
+        LP_EnterSleepMode();
+        __enable_irq();
+        __disable_irq();
+    }
+    __enable_irq();
+    return req->status;
+}
+
+/*****************************************************************************/
+int I2C_DMA_Transfer(i2c_dma_req_t *req)
+{
+    int err = I2C_DMA_Submit(req);
+
+    if (err != E_NO_ERROR) {
+        return err;
+    }
+    return I2C_DMA_Wait(req);
+}
+
+/*****************************************************************************/
+int I2C_DMA_Busy(void)
+{
+    return (queue_head != NULL);
+}
@@ -93,12 +93,46 @@
 #include "SSD1608_Display.h"
 
 //Screen Setup Data -- DO NOT EDIT --
-unsigned char LUT_DATA[30]= {
+static const uint8_t LUT_DATA[30]= {
  	  0x02, 0x02, 0x01, 0x11, 0x12, 0x12, 0x22, 0x22, 0x66, 0x69,
  	  0x69, 0x59, 0x58, 0x99, 0x99, 0x88, 0x00, 0x00, 0x00, 0x00,
  	  0xF8, 0xB4, 0x13, 0x51, 0x35, 0x51, 0x51, 0x19, 0x01, 0x00
  };
 
+//Partial update waveform -- DO NOT EDIT -- Drives only pixels that change, without the full black/white flash
+static const uint8_t LUT_PARTIAL[30]= {
+ 	  0x10, 0x18, 0x18, 0x08, 0x18, 0x18, 0x08, 0x00, 0x00, 0x00,
+ 	  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 	  0x13, 0x14, 0x44, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+ };
+
+/***** Init Sequences *****/
+static const uint8_t seq_dummy[] = { 0x1B };
+static const uint8_t seq_gateline[] = { 0x0B };
+static const uint8_t seq_mode[] = { 0x03 };						//X and Y increment
+static const uint8_t seq_vcom[] = { 0x70 };
+
+//Configuration of the 1.54" panel. Gate count and RAM window (NULL payloads) come from the panel's width and height
+const ssd1608_seq_t ssd1608_init_154[] = {
+	{ SSD1608_DRIVER_CONTROL, 3, 0, NULL },			//0x01
+	{ SSD1608_WRITE_DUMMY, 1, 0, seq_dummy },		//0x3a
+	{ SSD1608_WRITE_GATELINE, 1, 0, seq_gateline },	//0x3b
+	{ SSD1608_DATA_MODE, 1, 0, seq_mode },			//0x11
+	{ SSD1608_SET_RAMXPOS, 2, 0, NULL },			//0x44
+	{ SSD1608_SET_RAMYPOS, 4, 0, NULL },			//0x45
+	{ SSD1608_WRITE_VCOM, 1, 0, seq_vcom },			//0x2c
+	{ SSD1608_WRITE_LUT, 30, 0, LUT_DATA },			//0x32
+	{ 0, 0, SSD1608_SEQ_END, NULL }
+};
+
+//Software reset after power-up, waits for BUSY (or the worst case reset time)
+static const ssd1608_seq_t seq_sw_reset[] = {
+	{ SSD1608_SW_RESET, 0, SSD1608_SEQ_BUSY | RESET_WAIT_MS, NULL },
+	{ 0, 0, SSD1608_SEQ_END, NULL }
+};
+
+/***** Shared State (declared in SSD1608_Display.h) *****/
+volatile int spi_flag;
 
 /*
  * @brief	SPI Callback function
@@ -108,75 +142,501 @@ void spi_cb(void *req, int error)
     spi_flag = error;
 }
 
+/***** SPI DMA State *****/
+spi_stats_t spi_stats;
+void (*spi_trace)(int dc, const uint8_t *data, uint16_t len);	//NULL unless something is listening to the display traffic
+static int spi_dma_ch = -1;							//DMA channel feeding the SPI TX FIFO (-1 = not available)
+static volatile int spi_dma_busy;					//Set while a DMA-fed transaction is on the wire
+static void (*spi_dma_cb)(int error);				//Completion callback for the transaction in flight
+static uint8_t dma_stage[2][DMA_CHUNK_SIZE];		//Ping-pong staging buffers for windows narrower than a row
+
+static uint32_t spi_rate[SPI_INSTANCES];			//Bit rate each SPI instance is currently set to (0 = not initialized)
+
+/***** Command Sequencer State *****/
+static ssd1608_t *seq_disp;							//Panel the running sequence is sent to (NULL = idle)
+static const ssd1608_seq_t *seq_op;					//Entry being sent
+static void (*seq_cb)(ssd1608_t *disp);				//Completion callback for the running sequence
+
+/***** Panel Wait State *****/
+static ssd1608_t *tmr_owner;						//Panel BUSY_TMR is timing (NULL = timer free)
+static ssd1608_t *tmr_last;							//Last panel in the queue that starts at tmr_owner and follows tmrNext
+
+/*
+ * @brief	SPI master-done interrupt. Ends the DMA-fed transaction and runs its completion callback
+ */
+static void SPI_DMA_Handler(void)
+{
+	uint32_t flags = SPI_REGS->int_fl;
+	SPI_REGS->int_fl = flags;
+
+	if ((flags & MXC_F_SPI17Y_INT_FL_M_DONE) && spi_dma_busy)
+	{
+		SPI_REGS->int_en = 0;
+		SPI_REGS->dma &= ~MXC_F_SPI17Y_DMA_TX_DMA_EN;
+		DMA_Stop(spi_dma_ch);
+		spi_dma_busy = 0;
+		if (spi_dma_cb != NULL)
+		{
+			spi_dma_cb(E_NO_ERROR);
+		}
+	}
+}
+
+/*
+ * @brief	Acquire and configure the DMA channel that feeds SPI0A. Called from #SPIinit.
+ * @note       { If no channel is available, #SPItransferAsync falls back to blocking transfers }
+ */
+static void SPIdmaInit(void)
+{
+	if (spi_dma_ch >= 0)
+	{
+		return;
+	}
+
+	DMA_Init();
+	spi_dma_ch = DMA_AcquireChannel();
+	if (spi_dma_ch < 0)
+	{
+		return;
+	}
+
+	DMA_ConfigChannel(  spi_dma_ch,				//ch
+						DMA_PRIO_HIGH,			//prio
+						SPI_DMA_REQSEL,			//reqsel
+						1,						//reqwait_en
+						DMA_TIMEOUT_4_CLK,		//tosel
+						DMA_PRESCALE_DISABLE,	//pssel
+						DMA_WIDTH_BYTE,			//srcwd
+						1,						//srcinc_en
+						DMA_WIDTH_BYTE,			//dstwd
+						0,						//dstinc_en
+						1,						//burst_size (bytes-1)
+						0,						//chdis_inten
+						0						//ctz_inten
+						);
+
+	NVIC_SetVector(SPI_IRQ, SPI_DMA_Handler);
+	NVIC_EnableIRQ(SPI_IRQ);
+}
+
 /*
- * @brief	Initialize SPI protocol on MAX32660. Initial setup uses P0_6 (SCK), P0_5 (MOSI), and P0_4 (MISO)
+ * @brief	Initialize the panel's SPI instance at its bit rate. SPI0A uses P0_6 (SCK), P0_5 (MOSI), and P0_4 (MISO)
+ * @note       { Panels can share an instance with their own chip select. Commands go out at disp->speed, display RAM writes at the
+ * 			rate found by #SPIlinkTune }
  */
- void SPIinit(void)
+ void SPIinit(ssd1608_t *disp)
  {
 	 while (UART_Busy(MXC_UART_GET_UART(CONSOLE_UART)));
 	 Console_Shutdown();
 
 	    	// Configure the peripheral
-	 if (SPI_Init(SPI, 0, SPI_SPEED) != 0)
+	 if (SPI_Init(disp->spi, 0, disp->speed) != 0)
 	 {
 		 Console_Init();
 	     printf("Error configuring SPI\n");
 	 }
+	 spi_rate[disp->spi] = disp->speed;
+
+	 if (disp->spi == SPI0A)
+	 {
+		 SPIdmaInit();
+	 }
 }
 
 /*
- * @brief	Clears out buffer1 array holding screen data. Sets all bits to '1' (White)
+ * @brief	Clears out the framebuffer holding screen data. Sets all bits to '1' (White)
  */
-void ClearBuffer(void)
+void ClearBuffer(ssd1608_t *disp)
 {
-  memset(buffer1,0xFF,ARRAY_SIZE);
+  memset(disp->fb,0xFF,(disp->rowBytes * disp->height));
+  markDirty(disp, 0, 0, disp->width - 1, disp->height - 1);
   return;
 }
 
 /*
- * @brief	Initialize Enable Pins on MAX32660. All pinouts are described in GPIO pin definitions in SSD1608_Dispaly.h
+ * @brief	Grows the dirty region so that it covers the given rectangle. Drawing functions call this for every change to the framebuffer.
+ * @note       { Call this after writing the framebuffer directly (e.g. copying a bitmap into it), otherwise #displayScreen will not send the change }
+ * @param[(in)] <x0> { Left edge in pixels }
+ * @param[(in)] <y0> { Top row }
+ * @param[(in)] <x1> { Right edge in pixels (inclusive) }
+ * @param[(in)] <y1> { Bottom row (inclusive) }
+ */
+void markDirty(ssd1608_t *disp, int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+  if (x0 < disp->dirtyX0) disp->dirtyX0 = x0;
+  if (y0 < disp->dirtyY0) disp->dirtyY0 = y0;
+  if (x1 > disp->dirtyX1) disp->dirtyX1 = x1;
+  if (y1 > disp->dirtyY1) disp->dirtyY1 = y1;
+}
+
+/*
+ * @brief	Reports whether the framebuffer has changed since it was last sent to the screen
+ * @return     { 1 if any pixel is dirty, 0 otherwise }
+ */
+int isDirty(ssd1608_t *disp)
+{
+  return (disp->dirtyX0 <= disp->dirtyX1);
+}
+
+/*
+ * @brief	Empties the dirty region once the screen matches the framebuffer
+ */
+static void clearDirty(ssd1608_t *disp)
+{
+  disp->dirtyX0 = disp->width;
+  disp->dirtyY0 = disp->height;
+  disp->dirtyX1 = -1;
+  disp->dirtyY1 = -1;
+}
+
+/*
+ * @brief	Times disp->tmrMs on BUSY_TMR for the panel at the head of the timer queue
+ */
+static void tmrStart(ssd1608_t *disp)
+{
+  uint32_t ticks;
+  tmr_cfg_t cfg;
+
+  TMR_Disable(BUSY_TMR);
+  TMR_GetTicks(BUSY_TMR, disp->tmrMs, TMR_UNIT_MILLISEC, &ticks);
+  cfg.mode = TMR_MODE_ONESHOT;
+  cfg.cmp_cnt = ticks;
+  cfg.pol = 0;
+  TMR_Config(BUSY_TMR, &cfg);
+  TMR_IntClear(BUSY_TMR);
+  TMR_Enable(BUSY_TMR);
+}
+
+/*
+ * @brief	Ends the wait in flight and runs its completion callback. Called from the BUSY pin and timer interrupts, and from
+ * 			#panelWaitStart when BUSY has already dropped
+ * @note       { The wait is claimed with interrupts masked, so only one caller ends it. The mask is restored as it was before the
+ * 			callback runs. A timed wait hands BUSY_TMR to the next queued panel first }
+ */
+static void panelDone(ssd1608_t *disp)
+{
+  void (*callback)(ssd1608_t *disp);
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  if (disp->busyPin != 0)
+  {
+	  GPIO_IntDisable(&disp->busy);
+	  GPIO_IntClr(&disp->busy);
+  }
+  if (tmr_owner == disp)
+  {
+	  TMR_Disable(BUSY_TMR);
+	  TMR_IntClear(BUSY_TMR);
+	  tmr_owner = disp->tmrNext;
+	  disp->tmrNext = NULL;
+	  if (tmr_owner != NULL)
+	  {
+		  tmrStart(tmr_owner);				//Next queued timed wait
+	  }
+	  else
+	  {
+		  tmr_last = NULL;
+	  }
+  }
+
+  if (!disp->busyWait)
+  {
+	  __set_PRIMASK(primask);
+	  return;
+  }
+
+  callback = disp->busyCb;
+  disp->busyCb = NULL;
+  disp->busyWait = 0;
+  __set_PRIMASK(primask);
+  if (callback != NULL)
+  {
+	  callback(disp);
+  }
+}
+
+/*
+ * @brief	BUSY falling edge -- the panel has finished its reset or waveform
+ */
+static void BUSY_Handler(void *cbdata)
+{
+  panelDone((ssd1608_t *)cbdata);
+}
+
+/*
+ * @brief	One-shot wait timer expired
+ */
+static void BUSY_TMR_Handler(void)
+{
+  TMR_IntClear(BUSY_TMR);
+  if (tmr_owner != NULL)
+  {
+	  panelDone(tmr_owner);
+  }
+}
+
+/*
+ * @brief	Starts waiting for the panel without blocking. Completion is signalled by #panelDone.
+ * @note       { All panels share BUSY_TMR. A timed wait asked for while another panel's is running is queued and started
+ * 			from the timer interrupt when that one ends, so this never blocks and is safe from the SPI-done interrupt }
+ * @param[(in)] <ms> { Time to wait on BUSY_TMR. With useBusy set this is only used when the panel has no BUSY pin }
+ * @param[(in)] <useBusy> { 1 waits for BUSY to go low, 0 always waits the fixed time (e.g. supply and reset timing) }
+ * @param[(in)] <callback> { Called from interrupt context once the wait is over (may be NULL) }
+ */
+static void panelWaitStart(ssd1608_t *disp, unsigned int ms, int useBusy, void (*callback)(ssd1608_t *disp))
+{
+  uint32_t primask;
+
+  if (useBusy && disp->busyPin != 0)
+  {
+	  disp->busyCb = callback;
+	  disp->busyWait = 1;
+	  GPIO_IntClr(&disp->busy);
+	  GPIO_IntEnable(&disp->busy);
+
+	  //BUSY may already have dropped before the interrupt was armed. #panelDone claims the wait under the mask, so a BUSY
+	  //interrupt in between cannot end it twice
+	  if (GPIO_InGet(&disp->busy) == 0)
+	  {
+		  panelDone(disp);
+	  }
+	  return;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  disp->busyCb = callback;
+  disp->busyWait = 1;
+  disp->tmrMs = ms;
+  if (tmr_owner == NULL || tmr_owner == disp)
+  {
+	  if (tmr_owner == NULL)
+	  {
+		  disp->tmrNext = NULL;
+		  tmr_last = disp;
+	  }
+	  tmr_owner = disp;
+	  tmrStart(disp);
+  }
+  else
+  {
+	  disp->tmrNext = NULL;				//Started by #panelDone of the panel ahead of it
+	  tmr_last->tmrNext = disp;
+	  tmr_last = disp;
+  }
+  __set_PRIMASK(primask);
+}
+
+/*
+ * @brief	Reports whether the driver is still waiting on the panel (reset, power-up delay or waveform)
+ * @return     { 1 while busy, 0 when the panel is idle }
  */
-void pinInit (void)
+int displayBusy(ssd1608_t *disp)
 {
+  return disp->busyWait;
+}
 
-	cs.port = GPIO_PORT;
-	cs.mask = CS;
-	cs.func = GPIO_FUNC_OUT;
-	cs.pad = GPIO_PAD_NONE;
-	GPIO_Config(&cs);
+/*
+ * @brief	Sleeps the core until the panel is idle. Returns immediately if nothing is running.
+ * @note       { The core sits in SLEEP mode; any other interrupt wakes it briefly and it goes back to sleep }
+ */
+void displayWait(ssd1608_t *disp)
+{
+  __disable_irq();
+  while (disp->busyWait)
+  {
+	  LP_EnterSleepMode();
+	  __enable_irq();
+	  __disable_irq();
+  }
+  __enable_irq();
+}
 
-	dc.port = GPIO_PORT;
-	dc.mask = DC_SEL;
-	dc.func = GPIO_FUNC_OUT;
-	dc.pad = GPIO_PAD_NONE;
-	GPIO_Config(&dc);
+/*
+ * @brief	Fixed delay spent in SLEEP mode instead of spinning on MXC_TMR0
+ * @param[(in)] <ms> { Delay in milliseconds }
+ */
+static void sleepDelay(ssd1608_t *disp, unsigned int ms)
+{
+  panelWaitStart(disp, ms, 0, NULL);
+  displayWait(disp);
+}
 
-	rst.port = GPIO_PORT;
-	rst.mask = RST;
-	rst.func = GPIO_FUNC_OUT;
-	rst.pad = GPIO_PAD_NONE;
-	GPIO_Config(&rst);
+/*
+ * @brief	Initialize the panel's control pins and driver state. Pin, port and geometry settings are taken from disp (see #SSD1608_EVKIT_PANEL)
+ * @note       { Must be called once per panel before anything is sent to it. A busyPin of 0 means BUSY is not connected and the
+ * 			fixed worst case times are waited on BUSY_TMR instead }
+ */
+void pinInit(ssd1608_t *disp)
+{
+	disp->rowBytes = (disp->width + 7) / 8;
+	disp->state = PANEL_OFF;
+	disp->ram = RAM_NONE;
+	disp->lutPartial = 0;
+	disp->linkHz = 0;
+	disp->xferUs = 0;
+	disp->xferRunning = 0;
+	disp->busyWait = 0;
+	disp->busyCb = NULL;
+	disp->tmrNext = NULL;
+	disp->tmrMs = 0;
+	disp->dirtyX0 = 0;
+	disp->dirtyY0 = 0;
+	disp->dirtyX1 = disp->width - 1;
+	disp->dirtyY1 = disp->height - 1;
+
+	disp->geometry[GEOMETRY_DRIVER] = (disp->height - 1) & 0xFF;		//Gate lines - 1, then gate scan settings
+	disp->geometry[GEOMETRY_DRIVER + 1] = (disp->height - 1) >> 8;
+	disp->geometry[GEOMETRY_DRIVER + 2] = 0x00;
+	disp->geometry[GEOMETRY_RAMX] = 0x00;								//Byte columns 0 - rowBytes-1
+	disp->geometry[GEOMETRY_RAMX + 1] = disp->rowBytes - 1;
+	disp->geometry[GEOMETRY_RAMY] = 0x00;								//Rows 0 - height-1
+	disp->geometry[GEOMETRY_RAMY + 1] = 0x00;
+	disp->geometry[GEOMETRY_RAMY + 2] = (disp->height - 1) & 0xFF;
+	disp->geometry[GEOMETRY_RAMY + 3] = (disp->height - 1) >> 8;
+
+	disp->cs.port = disp->port;
+	disp->cs.mask = disp->csPin;
+	disp->cs.func = GPIO_FUNC_OUT;
+	disp->cs.pad = GPIO_PAD_NONE;
+	GPIO_Config(&disp->cs);
+
+	disp->dc.port = disp->port;
+	disp->dc.mask = disp->dcPin;
+	disp->dc.func = GPIO_FUNC_OUT;
+	disp->dc.pad = GPIO_PAD_NONE;
+	GPIO_Config(&disp->dc);
+
+	disp->rst.port = disp->port;
+	disp->rst.mask = disp->rstPin;
+	disp->rst.func = GPIO_FUNC_OUT;
+	disp->rst.pad = GPIO_PAD_NONE;
+	GPIO_Config(&disp->rst);
+
+	disp->en.port = disp->port;
+	disp->en.mask = disp->enPin;
+	disp->en.func = GPIO_FUNC_OUT;
+	disp->en.pad = GPIO_PAD_NONE;
+	GPIO_Config(&disp->en);
+
+	if (disp->busyPin != 0)
+	{
+		disp->busy.port = disp->port;
+		disp->busy.mask = disp->busyPin;
+		disp->busy.func = GPIO_FUNC_IN;
+		disp->busy.pad = GPIO_PAD_NONE;		//Driven by the panel
+		GPIO_Config(&disp->busy);
+
+		GPIO_RegisterCallback(&disp->busy, BUSY_Handler, disp);
+		GPIO_IntConfig(&disp->busy, GPIO_INT_EDGE, GPIO_INT_FALLING);
+		NVIC_EnableIRQ(GPIO0_IRQn);				//MAX32660 has only PORT_0
+	}
 
-	en.port = GPIO_PORT;
-	en.mask = EN;
-	en.func = GPIO_FUNC_OUT;
-	en.pad = GPIO_PAD_NONE;
-	GPIO_Config(&en);
+	TMR_Init(BUSY_TMR, TMR_PRES_4096, NULL);
+	NVIC_SetVector(BUSY_TMR_IRQ, BUSY_TMR_Handler);
+	NVIC_EnableIRQ(BUSY_TMR_IRQ);
 
 	//Set SSD1608 pins to unselected
-	GPIO_OutClr(&en);
-	GPIO_OutClr(&dc);
-	GPIO_OutSet(&cs);
+	GPIO_OutClr(&disp->en);
+	GPIO_OutClr(&disp->dc);
+	GPIO_OutSet(&disp->cs);
+}
+
+/*
+ * @brief	Works out the SPI0A clock dividers for a bit rate. SCK high and low each last a number of peripheral clocks (SystemCoreClock/2)
+ * 			times 2^scale, and the period is rounded up so the rate never exceeds hz
+ * @param[(in)] <hz> { Wanted bit rate }
+ * @param[(out)] <clkCfg> { Value for the clk_cfg register (may be NULL) }
+ * @return     { Bit rate the dividers give }
+ */
+static uint32_t SPIclkDiv(uint32_t hz, uint32_t *clkCfg)
+{
+	uint32_t period = (PeripheralClock + hz - 1) / hz;		//Peripheral clocks per bit
+	uint32_t scale = 0;
+
+	if (period < 2)
+	{
+		period = 2;
+	}
+	while (period > 510 && scale < 8)
+	{
+		period = (period + 1) / 2;
+		scale++;
+	}
+
+	if (clkCfg != NULL)
+	{
+		*clkCfg = (scale << MXC_F_SPI17Y_CLK_CFG_SCALE_POS) |
+				  (((period + 1) / 2) << MXC_F_SPI17Y_CLK_CFG_HI_POS) |
+				  ((period / 2) << MXC_F_SPI17Y_CLK_CFG_LO_POS);
+	}
+	return (PeripheralClock + (period << scale) - 1) / (period << scale);
+}
+
+/*
+ * @brief	Sets the bit rate of the panel's SPI instance once the transaction in flight has finished. Nothing is written when it already runs at hz
+ * @note       { SPI0A only gets new clock dividers. Other instances are initialized again }
+ * @param[(in)] <hz> { Bit rate }
+ */
+static void SPIrate(ssd1608_t *disp, uint32_t hz)
+{
+	uint32_t clkCfg;
+
+	if (spi_rate[disp->spi] == hz)
+	{
+		return;
+	}
+
+	SPIwait();
+	if (disp->spi == SPI0A)
+	{
+		SPIclkDiv(hz, &clkCfg);
+		SPI_REGS->clk_cfg = clkCfg;
+	}
+	else
+	{
+		SPI_Init(disp->spi, 0, hz);
+	}
+	spi_rate[disp->spi] = hz;
 }
 
+/*
+ * @brief	Reads bytes from the controller. MISO is not wired, so SPI0A runs in 3-wire mode and the controller drives SDA
+ * @param[(out)] <info> { Received bytes }
+ * @param[(in)] <len> { Number of bytes to read }
+ */
+static void SPIread(ssd1608_t *disp, uint8_t *info, uint16_t len)
+{
+    SPIwait();
+
+    spi_req_t req;
+	req.tx_data = NULL;			//Nothing is sent, SDA is an input for the whole transaction
+	req.rx_data = info;
+	req.len = len;
+	req.bits = 8;
+	req.width = SPI17Y_WIDTH_1;
+	req.ssel = 0;
+	req.deass = 0;
+	req.tx_num = 0;
+	req.rx_num = 0;
+	req.callback = spi_cb;
+	spi_flag =1;
+
+	SPI_REGS->ctrl2 |= MXC_F_SPI17Y_CTRL2_THREE_WIRE;
+	SPI_MasterTrans(disp->spi, &req);
+	SPI_REGS->ctrl2 &= ~MXC_F_SPI17Y_CTRL2_THREE_WIRE;
+}
 
 /*
- * @brief	Sends out data via SPI protocol with SPI0A pins. Data is sent from MAX32660 microcontroller to SSD1608 display
+ * @brief	Sends out data via SPI protocol on the panel's SPI instance. Data is sent from MAX32660 microcontroller to SSD1608 display
  * @param[(in)] <info> { Array pointer to data that shall be sent to electronic display via SPI protocol }
  * @param[(in)] <len> { Number of bytes to send }
  */
-void SPItransfer(uint8_t *info, uint16_t len)
+void SPItransfer(ssd1608_t *disp, const uint8_t *info, uint16_t len)
 {
+    SPIwait();
+
     spi_req_t req;
 	req.tx_data = info;			//Array pointer to data being sent
 	req.rx_data = NULL;			//Only send data, do not revieve
@@ -190,27 +650,121 @@ void SPItransfer(uint8_t *info, uint16_t len)
 	req.callback = spi_cb;
 	spi_flag =1;
 
-	SPI_MasterTrans(SPI, &req);
+	spi_stats.transactions++;
+	spi_stats.bytes += len;
+	if (spi_trace != NULL)
+	{
+		spi_trace(GPIO_OutGet(&disp->dc) != 0, info, len);
+	}
+	SPI_MasterTrans(disp->spi, &req);
+}
+
+/*
+ * @brief	Sends out data via SPI0A with the DMA controller filling the TX FIFO. Returns as soon as the transaction has started.
+ * @note       { Chip select and DC are GPIO controlled, so they must be set before the call and left untouched until completion.
+ * 			Panels on SPI1A (or without a DMA channel) get a blocking transfer and the callback runs before the call returns }
+ * @param[(in)] <info> { Array pointer to data that shall be sent. Must stay valid until the callback runs }
+ * @param[(in)] <len> { Number of bytes to send }
+ * @param[(in)] <callback> { Called from interrupt context when the last byte has been shifted out (may be NULL) }
+ * @return     { E_NO_ERROR once started, E_BUSY if a transaction is already in flight }
+ */
+int SPItransferAsync(ssd1608_t *disp, const uint8_t *info, uint16_t len, void (*callback)(int error))
+{
+	if (spi_dma_busy)
+	{
+		return E_BUSY;
+	}
+
+	if (spi_dma_ch < 0 || disp->spi != SPI0A)
+	{
+		SPItransfer(disp, info, len);
+		if (callback != NULL)
+		{
+			callback(E_NO_ERROR);
+		}
+		return E_NO_ERROR;
+	}
+
+	spi_dma_cb = callback;
+	spi_dma_busy = 1;
+	spi_stats.transactions++;
+	spi_stats.bytes += len;
+	if (spi_trace != NULL)
+	{
+		spi_trace(GPIO_OutGet(&disp->dc) != 0, info, len);
+	}
+
+	SPI_REGS->dma = MXC_F_SPI17Y_DMA_TX_FIFO_CLEAR | MXC_F_SPI17Y_DMA_RX_FIFO_CLEAR;
+	SPI_REGS->ctrl1 = ((uint32_t)len << MXC_F_SPI17Y_CTRL1_TX_NUM_CHAR_POS);
+	SPI_REGS->ctrl2 = (SPI_REGS->ctrl2 & ~MXC_F_SPI17Y_CTRL2_NUMBITS) | (8 << MXC_F_SPI17Y_CTRL2_NUMBITS_POS);
+	SPI_REGS->dma = MXC_F_SPI17Y_DMA_TX_FIFO_EN | MXC_F_SPI17Y_DMA_TX_DMA_EN | (SPI_DMA_LEVEL << MXC_F_SPI17Y_DMA_TX_FIFO_LEVEL_POS);
+	SPI_REGS->int_fl = SPI_REGS->int_fl;
+	SPI_REGS->int_en = MXC_F_SPI17Y_INT_EN_M_DONE;
+
+	DMA_Stop(spi_dma_ch);
+	DMA_SetSrcDstCnt(spi_dma_ch, (void *)info, 0, len);
+	DMA_Start(spi_dma_ch);
+	SPI_REGS->ctrl0 |= MXC_F_SPI17Y_CTRL0_START;
+
+	return E_NO_ERROR;
+}
+
+/*
+ * @brief	Zeroes the SPI traffic counters. Read #spi_stats after an update to see what one frame cost
+ */
+void SPIstatsReset(void)
+{
+	memset(&spi_stats, 0, sizeof(spi_stats));
+}
+
+/*
+ * @brief	Sleeps the core until the SPI transaction started by #SPItransferAsync has completed. Returns immediately if nothing is in flight.
+ * @note       { The core sits in SLEEP mode, so the DMA controller and SPI peripheral keep running }
+ */
+void SPIwait(void)
+{
+	__disable_irq();
+	while (spi_dma_busy)
+	{
+		LP_EnterSleepMode();		//WFI still wakes on a pending interrupt while they are masked
+		__enable_irq();
+		__disable_irq();
+	}
+	__enable_irq();
 }
 
 /*
  * @brief	Sends reset signal to display driver chip. Used during PowerUp function.
  * @note       { Electronic Paper Display (EPD) command is used to configure display module }
  */
-void hardwareReset(void)
+void hardwareReset(ssd1608_t *disp)
 {
-  GPIO_OutSet(&rst);
-  TMR_Delay(MXC_TMR0, MSEC(10), NULL);
+  GPIO_OutSet(&disp->rst);
+  sleepDelay(disp, 10);
 
-  GPIO_OutClr(&rst);
-  TMR_Delay(MXC_TMR0, MSEC(10), NULL);
+  GPIO_OutClr(&disp->rst);
+  sleepDelay(disp, 10);
 
-  GPIO_OutSet(&rst);
-  TMR_Delay(MXC_TMR0, MSEC(10), NULL);
+  GPIO_OutSet(&disp->rst);
+  sleepDelay(disp, 10);
 }
 
 
 
+/*
+ * @brief	Switches the SPI back to the command rate. The first command after a display RAM write also ends its timing
+ */
+static void commandRate(ssd1608_t *disp)
+{
+  if (disp->xferRunning)
+  {
+	  SPIwait();
+	  disp->xferUs = TMR_SW_Stop(XFER_TMR);
+	  disp->xferRunning = 0;
+  }
+  SPIrate(disp, disp->speed);
+}
+
 /*
  * @brief	Sends specified array data from MAX32660 to electronic screen via SPI
  * @note       { Electronic Paper Display (EPD) command is used to configure display module }
@@ -218,14 +772,14 @@ void hardwareReset(void)
  * @param[(in)] <buf> { Array of data to send }
  * @param[(in)] <len> { Length of data array }
  */
-void EPD_data(uint8_t *buf, uint16_t len)
+void EPD_data(ssd1608_t *disp, const uint8_t *buf, uint16_t len)
 {
-  GPIO_OutSet(&dc);
+  GPIO_OutSet(&disp->dc);
 
-  SPItransfer(buf, len);
+  SPItransfer(disp, buf, len);
 
-  GPIO_OutSet(&cs);
-  GPIO_OutClr(&dc);
+  GPIO_OutSet(&disp->cs);
+  GPIO_OutClr(&disp->dc);
 }
 
 /*
@@ -234,18 +788,21 @@ void EPD_data(uint8_t *buf, uint16_t len)
  * @param[(in)] <address> { Address information to send via SPI }
  * @param[(in)] <flag> { 1 de-selects module. 0 keeps module selected. (Continue or end transmission) }
  */
-void EPD_command2(uint8_t address, int flag)
+void EPD_command2(ssd1608_t *disp, uint8_t address, int flag)
 {
   uint8_t trans[1];
+
+  commandRate(disp);
   trans[0] = address;
-  GPIO_OutClr(&dc);
-  GPIO_OutClr(&cs);
+  GPIO_OutClr(&disp->dc);
+  GPIO_OutClr(&disp->cs);
+  spi_stats.commands++;
 
-  SPItransfer(trans,1);
+  SPItransfer(disp, trans,1);
 
   if (flag == 1)
   {
-	  GPIO_OutSet(&cs);
+	  GPIO_OutSet(&disp->cs);
   }
 }
 
@@ -257,269 +814,1454 @@ void EPD_command2(uint8_t address, int flag)
  * @param[(in)] <buf> { Array of buffer data which is used to configure register }
  * @param[(in)] <len> { Number of bytes to send from the selected buf array }
  */
-void EPD_command1(uint8_t address, uint8_t *buf, uint16_t len)
+void EPD_command1(ssd1608_t *disp, uint8_t address, const uint8_t *buf, uint16_t len)
 {
-  EPD_command2(address,0);
-  EPD_data(buf, len);
+  EPD_command2(disp, address,0);
+  EPD_data(disp, buf, len);
 }
+static void seqSend(ssd1608_t *disp);
+
 /*
- * @brief	Boot-up the e-ink display. Runs basic startup commands based on display module's data sheet
+ * @brief	Moves on to the next sequence entry. Called directly or once the wait after an entry is over
  */
-
-void powerUp(void)
+static void seqNext(ssd1608_t *disp)
 {
-  GPIO_OutSet(&en);
-  TMR_Delay(MXC_TMR0, MSEC(200), NULL);
-  uint8_t buf[5];
-  hardwareReset();
-  TMR_Delay(MXC_TMR0, MSEC(500), NULL);
-
-  EPD_command2(SSD1608_SW_RESET, 1);
-
-  TMR_Delay(MXC_TMR0, MSEC(500), NULL);
-
-  buf[0] = 0xc7;
-  buf[1] = 0x00;
-  buf[2] = 0x00;
-  EPD_command1(SSD1608_DRIVER_CONTROL, buf, 3);   //0x01
-
-  buf[0] = 0x1B;
-  EPD_command1(SSD1608_WRITE_DUMMY, buf, 1);    //0x3a
-
-  buf[0] = 0x0B;
-  EPD_command1(SSD1608_WRITE_GATELINE, buf, 1);   //0x3b
-
-  buf[0] = 0x03;
-  EPD_command1(SSD1608_DATA_MODE, buf, 1);    //0x11
-
-  buf[0] = 0x00;
-  buf[1] = 0x18;
-  EPD_command1(SSD1608_SET_RAMXPOS, buf, 2);    //0x44
+  seq_op++;
+  seqSend(disp);
+}
 
-  buf[0] = 0x00;
-  buf[1] = 0x00;
-  buf[2] = 0xc7;
-  buf[3] = 0x00;
-  EPD_command1(SSD1608_SET_RAMYPOS, buf, 4);  //0x45
+/*
+ * @brief	SPI done for the payload of the current entry. Deselects the panel and starts the wait the entry asks for
+ */
+static void seqDataDone(int error)
+{
+  ssd1608_t *disp = seq_disp;
+  uint16_t delay = seq_op->delay;
 
-  buf[0] = 0x70;
-  EPD_command1(SSD1608_WRITE_VCOM, buf, 1);   //0x2c
+  GPIO_OutSet(&disp->cs);
+  GPIO_OutClr(&disp->dc);
 
-  EPD_command1(SSD1608_WRITE_LUT, LUT_DATA, 30);  //0x32
-  GPIO_OutSet(&cs);
+  if (delay != 0)
+  {
+	  panelWaitStart(disp, delay & ~SSD1608_SEQ_BUSY, (delay & SSD1608_SEQ_BUSY) != 0, seqNext);
+  }
+  else
+  {
+	  seqNext(disp);
+  }
 }
 
 /*
- * @brief	Set display's RAM address pointer
- * @param[(in)] <x> { X address counter value }
- * @param[(in)] <y> { Y address counter value }
+ * @brief	Finds the payload of a sequence entry. Entries without one take the panel's geometry (see #pinInit)
+ * @return     { Payload, or NULL if the entry has none and is not a geometry command }
  */
-void setRAM (uint16_t x, uint16_t y)
+static const uint8_t *seqPayload(ssd1608_t *disp, const ssd1608_seq_t *op)
 {
-  uint8_t buf[2];
-  buf[0] = x;
-  EPD_command1(SSD1608_SET_RAMXCOUNT, buf, 1);
+  if (op->data != NULL)
+  {
+	  return op->data;
+  }
 
-  buf[0] = y >> 8;
-  buf[1] = y;
-  EPD_command1(SSD1608_SET_RAMYCOUNT, buf, 2);
+  switch (op->cmd)
+  {
+	  case SSD1608_DRIVER_CONTROL:
+		  return &disp->geometry[GEOMETRY_DRIVER];
+	  case SSD1608_SET_RAMXPOS:
+		  return &disp->geometry[GEOMETRY_RAMX];
+	  case SSD1608_SET_RAMYPOS:
+		  return &disp->geometry[GEOMETRY_RAMY];
+	  default:
+		  return NULL;
+  }
 }
 
 /*
- * @brief	Sends address to configure RAM
+ * @brief	SPI done for the command byte of the current entry. Raises DC and sends the payload straight from the table
+ * 			(or from the panel's geometry)
  */
-void writeRAM()
+static void seqCmdDone(int error)
 {
-  EPD_command2(SSD1608_WRITE_RAM, 0);
+  ssd1608_t *disp = seq_disp;
+  const uint8_t *data = seqPayload(disp, seq_op);
+
+  if (seq_op->len == 0 || data == NULL)
+  {
+	  seqDataDone(error);
+	  return;
+  }
+
+  GPIO_OutSet(&disp->dc);
+  SPItransferAsync(disp, data, seq_op->len, seqDataDone);
 }
 
 /*
- * @brief	Refreshes screen based on data most recent data sent from buffer1
- * 
- * @note       { Make sure data has been sent to screen via #BitMapTransfer -- Function already built into #dispalyScreen }
+ * @brief	Sends the command byte of the current entry, or ends the sequence at its terminator
  */
-void updateScreen (void)
+static void seqSend(ssd1608_t *disp)
 {
-  uint8_t buf[1];
-  buf[0]= 0xC7;
-  EPD_command1(SSD1608_DISP_CTRL2, buf, 1);
+  void (*callback)(ssd1608_t *disp);
+
+  if (seq_op->delay == SSD1608_SEQ_END)
+  {
+	  callback = seq_cb;
+	  seq_cb = NULL;
+	  seq_disp = NULL;
+	  disp->busyWait = 0;
+	  if (callback != NULL)
+	  {
+		  callback(disp);
+	  }
+	  return;
+  }
 
-  EPD_command2(SSD1608_MASTER_ACTIVATE, 1);
-  TMR_Delay(MXC_TMR0, MSEC(2000), NULL);
-  GPIO_OutClr(&en);
+  disp->busyWait = 1;
+  GPIO_OutClr(&disp->dc);
+  GPIO_OutClr(&disp->cs);
+  spi_stats.commands++;
+  SPItransferAsync(disp, &seq_op->cmd, 1, seqCmdDone);
 }
 
 /*
- * @brief	Sends new screen information by reversing every 8 bits (Gimp exports bitmaps least significant bit first, but display accepts most significant first)
- * @param[(in)] <logo> { Data Array with bits reversed before being sent via SPI }
- * @param[(in)] <len> { Number of bytes to send from data array }
+ * @brief	Sends a command sequence (e.g. disp->initSeq) and returns while it runs. Each entry is started from the SPI-done and
+ * 			BUSY/timer interrupts of the one before, so the core can sleep between them.
+ * @note       { The panel counts as busy until the terminator is reached (#displayBusy, #displayWait). Payloads are sent straight
+ * 			from the table, so tables must stay valid until the callback }
+ * @param[(in)] <seq> { Entries ending with an SSD1608_SEQ_END entry }
+ * @param[(in)] <callback> { Called from interrupt context once the last entry and its wait are done (may be NULL) }
+ * @return     { E_NO_ERROR once started, E_BUSY if the panel or the sequencer is still busy }
  */
-void BitMapTransfer(uint8_t *Design, int len)
+int runSequence(ssd1608_t *disp, const ssd1608_seq_t *seq, void (*callback)(ssd1608_t *disp))
 {
-	uint8_t buf[1];
-	for (int i = 0; i<len;i++)
-	{
-		buf[0] = (((Design[i]>>7 & 0x01) + (Design[i]>>5 & 0x02) + (Design[i]>>3 & 0x04) + (Design[i]>>1 & 0x08) + (Design[i]<<1 & 0x10) + (Design[i]<<3 & 0x20) +(Design[i]<<5 & 0x40) + (Design[i]<<7 & 0x80)));
-		SPItransfer(buf, 1);
-	}
+  if (disp->busyWait || seq_disp != NULL)
+  {
+	  return E_BUSY;
+  }
+
+  commandRate(disp);
+  seq_disp = disp;
+  seq_op = seq;
+  seq_cb = callback;
+  seqSend(disp);
+  return E_NO_ERROR;
 }
 
 /*
- * @brief	Sends all of buffer1 data to screen, and then refreshes display
+ * @brief	Writes the controller configuration from disp->initSeq (driver output, dummy/gate line timing, data entry mode, RAM window, VCOM, full LUT).
+ * @note       { Registers are lost on reset, so this runs after every power-up and every wake from deep sleep }
  */
-void displayScreen(void)
+static void panelConfig(ssd1608_t *disp)
 {
-  powerUp();
-  setRAM(0, 0);
-  writeRAM();
-
-  GPIO_OutSet(&dc);
-  BitMapTransfer(buffer1, ARRAY_SIZE);
-
-  GPIO_OutSet(&cs);
-  updateScreen();
+  runSequence(disp, disp->initSeq, NULL);
+  displayWait(disp);
+  disp->lutPartial = 0;
 }
 
-/* @brief	Function used to edit screen buffer array and directly write edit individual pixels.
- * @param[(in)] <x> { Desired X position of Pixel }
- * @param[(in)] <y> { Desired Y position of Pixel }
- * @param[(in)] <color> { Desired color value (White = 1 ; Black = 0) }
+/*
+ * @brief	Brings the controller to the ready state from whatever state it is in.
+ * @note       { From PANEL_OFF this is the full bring-up (supply, hardware and software reset). From PANEL_SLEEP a hardware
+ * 			reset is enough to leave deep sleep. Either way the configuration registers have to be written again. Nothing
+ * 			is sent when the controller is already ready }
  */
-
-void drawPixel(int16_t x, int16_t y, int color)
+static void panelReady(ssd1608_t *disp)
 {
-  x = round (x);
-  y = round (y);
-
-  if((x < 0) || (y < 0) || (x >= 200) || (y >= 200)) return;		//Out of Range
+  if (disp->state == PANEL_READY)
+  {
+	  return;
+  }
 
-  int value = x + (y * 200);		//Find index for specific pixel
-  int rem = value % 8;				//Which bit to modify with index (0-7)
-  int index = trunc(value/8);		//Finds the position in buffer1 to modify
-  int shift = 7-rem;
-  if(color ==1)
+  if (disp->state == PANEL_SLEEP)
   {
-	  int gate1 = (0xFF & (color << shift));
-	  gate1 = (0xFF ^ gate1);
-	  buffer1[index] = (buffer1[index] & gate1);
+	  hardwareReset(disp);
+	  panelWaitStart(disp, RESET_WAIT_MS, 1, NULL);
+	  displayWait(disp);
+#if !SSD1608_SLEEP_KEEPS_RAM
+	  disp->ram = RAM_NONE;
+#endif
   }
   else
   {
-	  int next;
-	  int gate2 =0;
-	  for(int i=0;i<8;i++)
-	  {
-		  if(i == shift)
-		  {
-			  next = 0;
-		  }
-		  else
-		  {
-			  next = 1;
-		  }
-		  gate2 = (gate2 << 1) | next;
-	  }
-	  buffer1[index] = (buffer1[index] & gate2);
+	  GPIO_OutSet(&disp->en);
+	  sleepDelay(disp, 200);			//Supply settling, BUSY is not valid until the panel is powered
+	  hardwareReset(disp);
+	  panelWaitStart(disp, RESET_WAIT_MS, 1, NULL);
+	  displayWait(disp);
+
+	  runSequence(disp, seq_sw_reset, NULL);
+	  displayWait(disp);
+	  disp->ram = RAM_NONE;
   }
+
+  panelConfig(disp);
+  disp->state = PANEL_READY;
 }
 
 /*
- * @brief	Draw a line between two designated points. Function will update values in buffer1
- * @param[(in)] <x0> { X position of first point in line }
+ * @brief	Boot-up the e-ink display (or wake it from deep sleep) so display RAM can be written directly.
+ * @note       { Use this when sending data that is not in the framebuffer (e.g. a splash screen with #BitMapTransfer). The driver no
+ * 			longer assumes display RAM matches the framebuffer, so the next #displayScreen sends the whole buffer }
+ */
+void powerUp(ssd1608_t *disp)
+{
+  panelReady(disp);
+  disp->ram = RAM_NONE;
+}
+
+/*
+ * @brief	Puts the controller into deep sleep once the panel is idle. The image stays on the panel and supply current drops
+ * 			to the controller's deep sleep current. The next update wakes it with a hardware reset instead of a full bring-up.
+ */
+void displaySleep(ssd1608_t *disp)
+{
+  uint8_t buf[1];
+
+  if (disp->state != PANEL_READY)
+  {
+	  return;
+  }
+
+  displayWait(disp);
+  buf[0] = 0x01;
+  EPD_command1(disp, SSD1608_DEEP_SLEEP, buf, 1);
+  disp->state = PANEL_SLEEP;
+}
+
+/*
+ * @brief	Set display's RAM address pointer
+ * @param[(in)] <x> { X address counter value }
+ * @param[(in)] <y> { Y address counter value }
+ */
+void setRAM(ssd1608_t *disp, uint16_t x, uint16_t y)
+{
+  uint8_t buf[2];
+  buf[0] = x;
+  EPD_command1(disp, SSD1608_SET_RAMXCOUNT, buf, 1);
+
+  buf[0] = y;				//Y counter is sent low byte first
+  buf[1] = y >> 8;
+  EPD_command1(disp, SSD1608_SET_RAMYCOUNT, buf, 2);
+}
+
+/*
+ * @brief	Limit display RAM access to a window. The address counter wraps inside the window while data is written
+ * @param[(in)] <xs> { First byte column (0 - rowBytes-1) }
+ * @param[(in)] <xe> { Last byte column (0 - rowBytes-1) }
+ * @param[(in)] <ys> { First row (0 - height-1) }
+ * @param[(in)] <ye> { Last row (0 - height-1) }
+ */
+static void setRAMWindow(ssd1608_t *disp, uint8_t xs, uint8_t xe, uint16_t ys, uint16_t ye)
+{
+  uint8_t buf[4];
+  buf[0] = xs;
+  buf[1] = xe;
+  EPD_command1(disp, SSD1608_SET_RAMXPOS, buf, 2);
+
+  buf[0] = ys;
+  buf[1] = ys >> 8;
+  buf[2] = ye;
+  buf[3] = ye >> 8;
+  EPD_command1(disp, SSD1608_SET_RAMYPOS, buf, 4);
+}
+
+/*
+ * @brief	Sends address to configure RAM. The data that follows goes out at the rate found by #SPIlinkTune
+ * @note       { The write is timed on XFER_TMR until the next command, see disp->xferUs }
+ */
+void writeRAM(ssd1608_t *disp)
+{
+  EPD_command2(disp, SSD1608_WRITE_RAM, 0);
+  SPIrate(disp, (disp->linkHz != 0) ? disp->linkHz : disp->speed);
+  TMR_SW_Start(XFER_TMR, NULL);
+  disp->xferRunning = 1;
+}
+
+/*
+ * @brief	Writes a test pattern into the top rows of display RAM at one bit rate and reads it back at the command rate
+ * @note       { The first byte after #SSD1608_READ_RAM is a dummy byte }
+ * @param[(in)] <hz> { Bit rate to write at }
+ * @return     { 1 if both patterns read back unchanged, 0 otherwise }
+ */
+static int linkCheck(ssd1608_t *disp, uint32_t hz)
+{
+  uint8_t *pattern = dma_stage[0];
+  uint8_t *readback = dma_stage[1];
+  int rows = (DMA_CHUNK_SIZE - 1) / disp->rowBytes;
+  int len = rows * disp->rowBytes;
+
+  for (int pass = 0; pass < 2; pass++)
+  {
+	  for (int i = 0; i < len; i++)
+	  {
+		  pattern[i] = (uint8_t)(i * 0x4B) ^ (pass ? 0xAA : 0x55);		//Every bit toggles between neighbouring bytes and passes
+	  }
+
+	  setRAMWindow(disp, 0, disp->rowBytes - 1, 0, rows - 1);
+	  setRAM(disp, 0, 0);
+	  disp->linkHz = hz;
+	  writeRAM(disp);
+	  GPIO_OutSet(&disp->dc);
+	  SPItransfer(disp, pattern, len);
+	  GPIO_OutSet(&disp->cs);
+
+	  setRAM(disp, 0, 0);
+	  EPD_command2(disp, SSD1608_READ_RAM, 0);
+	  GPIO_OutSet(&disp->dc);
+	  SPIread(disp, readback, len + 1);
+	  GPIO_OutSet(&disp->cs);
+	  GPIO_OutClr(&disp->dc);
+
+	  if (memcmp(&readback[1], pattern, len) != 0)
+	  {
+		  return 0;
+	  }
+  }
+  return 1;
+}
+
+/*
+ * @brief	Finds the highest bit rate display RAM writes work at, starting from disp->ramSpeed and stepping down by a quarter
+ * 			until a test pattern reads back unchanged. Commands stay at disp->speed
+ * @note       { Powers the panel up and overwrites display RAM, so the next #displayScreen sends the whole framebuffer. Only SPI0A
+ * 			can read back (3-wire mode); panels on other instances write RAM at ramSpeed untested. The result is in disp->linkHz }
+ * @return     { E_NO_ERROR, E_NOT_SUPPORTED if the instance cannot read back, E_COMM_ERR if nothing read back correctly, not
+ * 			even at the command rate (RAM writes then stay at disp->speed) }
+ */
+int SPIlinkTune(ssd1608_t *disp)
+{
+  uint32_t hz;
+
+  if (disp->spi != SPI0A)
+  {
+	  disp->linkHz = disp->ramSpeed;
+	  return E_NOT_SUPPORTED;
+  }
+
+  panelReady(disp);
+  disp->ram = RAM_NONE;
+
+  for (hz = disp->ramSpeed; hz > disp->speed; hz -= hz / 4)
+  {
+	  if (linkCheck(disp, hz))
+	  {
+		  break;
+	  }
+  }
+  if (hz <= disp->speed)
+  {
+	  hz = disp->speed;
+	  if (!linkCheck(disp, hz))
+	  {
+		  hz = 0;
+	  }
+  }
+
+  disp->linkHz = (hz != 0) ? SPIclkDiv(hz, NULL) : 0;
+  setRAMWindow(disp, 0, disp->rowBytes - 1, 0, disp->height - 1);	//Back to the window set by panelConfig
+  SPIwait();
+  return (hz != 0) ? E_NO_ERROR : E_COMM_ERR;
+}
+
+/*
+ * @brief	Starts the display update sequence with the waveform currently loaded. Returns while the waveform runs.
+ * @param[(in)] <ms> { Waveform duration in milliseconds, used when BUSY is not connected }
+ * @param[(in)] <callback> { Called from interrupt context when the panel is idle again (may be NULL) }
+ */
+static void refreshStart(ssd1608_t *disp, unsigned int ms, void (*callback)(ssd1608_t *disp))
+{
+  uint8_t buf[1];
+  displayWait(disp);
+  buf[0]= 0xC7;
+  EPD_command1(disp, SSD1608_DISP_CTRL2, buf, 1);
+
+  EPD_command2(disp, SSD1608_MASTER_ACTIVATE, 1);
+  panelWaitStart(disp, ms, 1, callback);
+}
+
+/*
+ * @brief	Runs the display update sequence with the waveform currently loaded and sleeps until it has finished
+ * @param[(in)] <ms> { Waveform duration in milliseconds, used when BUSY is not connected }
+ */
+static void refreshScreen(ssd1608_t *disp, unsigned int ms)
+{
+  refreshStart(disp, ms, NULL);
+  displayWait(disp);
+}
+
+/*
+ * @brief	Refreshes screen based on data most recent data sent from the framebuffer
+ *
+ * @note       { Make sure data has been sent to screen via #BitMapTransfer -- Function already built into #dispalyScreen }
+ */
+void updateScreen(ssd1608_t *disp)
+{
+  refreshScreen(disp, FULL_REFRESH_MS);
+}
+
+/*
+ * @brief	Starts a full refresh and returns while the waveform runs. The core is free to sleep or do other work until callback.
+ * @note       { Do not send anything to the display until the callback has run or #displayBusy returns 0 -- #displayWait sleeps until then }
+ * @param[(in)] <callback> { Called from interrupt context when the refresh has finished (may be NULL) }
+ * @return     { E_NO_ERROR once started, E_BUSY if the panel is still busy with an earlier refresh }
+ */
+int updateScreenAsync(ssd1608_t *disp, void (*callback)(ssd1608_t *disp))
+{
+  if (disp->busyWait)
+  {
+	  return E_BUSY;
+  }
+
+  refreshStart(disp, FULL_REFRESH_MS, callback);
+  return E_NO_ERROR;
+}
+
+/*
+ * @brief	Cuts power to the display. The image stays on the panel, but display RAM is lost, so the next
+ * 			#displayRegion falls back to a full #displayScreen.
+ */
+void powerDown(ssd1608_t *disp)
+{
+  displayWait(disp);
+  GPIO_OutClr(&disp->en);
+  disp->state = PANEL_OFF;
+  disp->ram = RAM_NONE;
+}
+
+/*
+ * @brief	Sends a rectangle of bitmap data to display RAM
+ * @note       { Contiguous data goes out in a single DMA transaction straight from src. Narrower windows are packed row by
+ * 			row into two staging buffers, so copying one chunk overlaps with the DMA transfer of the other }
+ * @param[(in)] <src> { First byte of the rectangle }
+ * @param[(in)] <width> { Bytes to send from each row }
+ * @param[(in)] <stride> { Distance in bytes between the start of two rows in src }
+ * @param[(in)] <rows> { Number of rows to send }
+ */
+static void BitMapTransferRect(ssd1608_t *disp, const uint8_t *src, int width, int stride, int rows)
+{
+	if (width == stride || rows == 1)
+	{
+		int len = width * rows;
+		while (len > 0)
+		{
+			uint16_t count = (len > 0xFFFF) ? 0xFFFF : len;
+			SPIwait();
+			SPItransferAsync(disp, src, count, NULL);
+			src += count;
+			len -= count;
+		}
+		SPIwait();
+		return;
+	}
+
+	int stage = 0;
+	int count = 0;
+	uint8_t *buf = dma_stage[stage];
+
+	for (int r = 0; r<rows; r++)
+	{
+		const uint8_t *row = src + (r * stride);
+		int done = 0;
+		while (done < width)
+		{
+			int n = width - done;
+			if (n > DMA_CHUNK_SIZE - count)
+			{
+				n = DMA_CHUNK_SIZE - count;
+			}
+			memcpy(&buf[count], &row[done], n);
+			count += n;
+			done += n;
+
+			if (count == DMA_CHUNK_SIZE)
+			{
+				SPIwait();
+				SPItransferAsync(disp, buf, count, NULL);
+				stage ^= 1;
+				buf = dma_stage[stage];
+				count = 0;
+			}
+		}
+	}
+
+	if (count > 0)
+	{
+		SPIwait();
+		SPItransferAsync(disp, buf, count, NULL);
+	}
+	SPIwait();
+}
+
+/*
+ * @brief	Sends bitmap data to display RAM in one DMA transaction
+ * @note       { Data must be in display order (most significant bit = leftmost pixel). GIMP exports are converted
+ * 			once with tools/xbm2lut.py, so no per-byte transform is needed at run time }
+ * @param[(in)] <Design> { Data Array to send via SPI }
+ * @param[(in)] <len> { Number of bytes to send from data array }
+ */
+void BitMapTransfer(ssd1608_t *disp, const uint8_t *Design, int len)
+{
+	BitMapTransferRect(disp, Design, len, len, 1);
+}
+
+/*
+ * @brief	Starts decoding a compressed bitmap
+ * @note       { Bitmaps are compressed by XORing every row with the row above (the first with white), then PackBits.
+ * 			Control byte n: 0 - 127 = n+1 literal bytes follow, 129 - 255 = next byte repeats 257-n times, 128 = no-op }
+ * @param[(in)] <s> { Decoder state }
+ * @param[(in)] <src> { Compressed data (e.g. logo_rle) }
+ * @param[(in)] <size> { Size of the compressed data in bytes }
+ * @param[(in)] <rowBytes> { Bytes per row of the bitmap (at most SSD1608_MAX_ROW_BYTES) }
+ */
+void RLEbegin(rle_stream_t *s, const uint8_t *src, uint16_t size, uint8_t rowBytes)
+{
+	s->src = src;
+	s->end = src + size;
+	s->count = 0;
+	s->repeat = 0;
+	s->value = 0;
+	s->col = 0;
+	s->rowBytes = rowBytes;
+	memset(s->row, 0x00, rowBytes);
+}
+
+/*
+ * @brief	Decodes the next bytes of a compressed bitmap. Can be called repeatedly to stream the bitmap in chunks
+ * @param[(in)] <s> { Decoder state set up by #RLEbegin }
+ * @param[(out)] <dst> { Output bytes in display order }
+ * @param[(in)] <len> { Maximum number of bytes to decode }
+ * @return     { Number of bytes written to dst. Less than len once the compressed data runs out }
+ */
+uint16_t RLEread(rle_stream_t *s, uint8_t *dst, uint16_t len)
+{
+	uint16_t n = 0;
+
+	while (n < len)
+	{
+		if (s->count == 0)
+		{
+			if (s->src >= s->end)
+			{
+				break;
+			}
+
+			uint8_t c = *s->src++;
+			if (c < 128)
+			{
+				s->count = c + 1;
+				s->repeat = 0;
+			}
+			else if (c > 128)
+			{
+				s->count = 257 - c;
+				s->repeat = 1;
+				s->value = *s->src++;
+			}
+			continue;
+		}
+
+		uint8_t b = s->repeat ? s->value : *s->src++;
+		b ^= s->row[s->col];
+		s->row[s->col] = b;
+		dst[n++] = b;
+		s->count--;
+
+		if (++s->col == s->rowBytes)
+		{
+			s->col = 0;
+		}
+	}
+	return n;
+}
+
+/*
+ * @brief	Expands a compressed bitmap into a buffer, e.g. to composite a background into the framebuffer
+ * @note       { Does not mark anything dirty. Call #markDirty when decoding into the framebuffer }
+ * @param[(out)] <dst> { Destination buffer, at least len bytes }
+ * @param[(in)] <src> { Compressed data }
+ * @param[(in)] <size> { Size of the compressed data in bytes }
+ * @param[(in)] <len> { Number of decoded bytes to write (rowBytes * height for a full screen) }
+ * @param[(in)] <rowBytes> { Bytes per row of the bitmap }
+ */
+void RLEdecode(uint8_t *dst, const uint8_t *src, uint16_t size, uint16_t len, uint8_t rowBytes)
+{
+	rle_stream_t s;
+	RLEbegin(&s, src, size, rowBytes);
+	RLEread(&s, dst, len);
+}
+
+/*
+ * @brief	Sends a compressed bitmap to display RAM without expanding it in SRAM first
+ * @note       { Chunks are decoded into the two DMA staging buffers, so decoding one chunk overlaps with the transfer of the
+ * 			other. DC and chip select are handled like #BitMapTransfer }
+ * @param[(in)] <src> { Compressed data (e.g. logo_rle) }
+ * @param[(in)] <size> { Size of the compressed data in bytes }
+ * @param[(in)] <len> { Number of decoded bytes to send (rowBytes * height for a full screen) }
+ */
+void BitMapTransferRLE(ssd1608_t *disp, const uint8_t *src, uint16_t size, int len)
+{
+	rle_stream_t s;
+	int stage = 0;
+
+	RLEbegin(&s, src, size, disp->rowBytes);
+	while (len > 0)
+	{
+		uint16_t count = RLEread(&s, dma_stage[stage], (len > DMA_CHUNK_SIZE) ? DMA_CHUNK_SIZE : len);
+		if (count == 0)
+		{
+			break;
+		}
+
+		SPIwait();
+		SPItransferAsync(disp, dma_stage[stage], count, NULL);
+		stage ^= 1;
+		len -= count;
+	}
+	SPIwait();
+}
+
+/*
+ * @brief	Powers up the display, sends all of the framebuffer and runs the full waveform
+ */
+static void displayFull(ssd1608_t *disp)
+{
+  panelReady(disp);
+  if (disp->lutPartial)
+  {
+	  EPD_command1(disp, SSD1608_WRITE_LUT, LUT_DATA, 30);
+	  disp->lutPartial = 0;
+  }
+  setRAMWindow(disp, 0, disp->rowBytes - 1, 0, disp->height - 1);
+  setRAM(disp, 0, 0);
+  writeRAM(disp);
+
+  GPIO_OutSet(&disp->dc);
+  BitMapTransfer(disp, disp->fb, (disp->rowBytes * disp->height));
+
+  GPIO_OutSet(&disp->cs);
+  updateScreen(disp);
+  disp->ram = RAM_FRAMEBUFFER;
+  clearDirty(disp);
+}
+
+/*
+ * @brief	Sends the framebuffer changes to screen, and then refreshes display
+ * @note       { The first call (or the first after #powerDown) sends the whole buffer with the full waveform. After that only
+ * 			the dirty region is sent through #displayRegion, and nothing is sent or refreshed when the framebuffer has not changed.
+ * 			The controller is put into deep sleep afterwards with its RAM kept, so the next update only needs a wake-up.
+ * 			Call #powerDown to cut its supply }
+ */
+void displayScreen(ssd1608_t *disp)
+{
+  if (disp->ram != RAM_FRAMEBUFFER)
+  {
+	  displayFull(disp);
+	  displaySleep(disp);
+  }
+  else if (isDirty(disp))
+  {
+	  displayRegion(disp, disp->dirtyX0, disp->dirtyY0, disp->dirtyX1, disp->dirtyY1);
+  }
+}
+
+/*
+ * @brief	Sends only a rectangle of the framebuffer to the screen and refreshes it with the partial-update waveform.
+ * @note       { Needs display RAM to already hold the framebuffer. After #powerDown (or before the first #displayScreen) the whole
+ * 			buffer is sent with the full waveform instead. X coordinates are rounded out to whole bytes (8 pixels). }
+ * @param[(in)] <x0> { X position of first corner (0 - 199) }
+ * @param[(in)] <y0> { Y position of first corner (0 - 199) }
+ * @param[(in)] <x1> { X position of opposite corner (0 - 199) }
+ * @param[(in)] <y1> { Y position of opposite corner (0 - 199) }
+ */
+void displayRegion(ssd1608_t *disp, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+  if (disp->ram != RAM_FRAMEBUFFER)
+  {
+	  displayFull(disp);
+	  displaySleep(disp);
+	  return;
+  }
+
+  uint16_t hold;
+  if (x0 > x1) { hold = x0; x0 = x1; x1 = hold; }
+  if (y0 > y1) { hold = y0; y0 = y1; y1 = hold; }
+  if (x0 >= disp->width || y0 >= disp->height) return;		//Out of Range
+  if (x1 >= disp->width) x1 = disp->width - 1;
+  if (y1 >= disp->height) y1 = disp->height - 1;
+
+  uint8_t xs = x0 / 8;
+  uint8_t xe = x1 / 8;
+  int width = xe - xs + 1;
+  int rows = y1 - y0 + 1;
+  uint8_t *src = &disp->fb[xs + (y0 * disp->rowBytes)];
+
+  panelReady(disp);
+  if (disp->ram != RAM_FRAMEBUFFER)				//RAM was not retained through deep sleep
+  {
+	  displayFull(disp);
+	  displaySleep(disp);
+	  return;
+  }
+
+  if (!disp->lutPartial)
+  {
+	  EPD_command1(disp, SSD1608_WRITE_LUT, LUT_PARTIAL, 30);
+	  disp->lutPartial = 1;
+  }
+
+  //The controller swaps RAM banks on every refresh, so the window is written before and after the update to keep both banks equal
+  for (int pass = 0; pass < 2; pass++)
+  {
+	  setRAMWindow(disp, xs, xe, y0, y1);
+	  setRAM(disp, xs, y0);
+	  writeRAM(disp);
+
+	  GPIO_OutSet(&disp->dc);
+	  BitMapTransferRect(disp, src, width, disp->rowBytes, rows);
+	  GPIO_OutSet(&disp->cs);
+
+	  if (pass == 0)
+	  {
+		  refreshScreen(disp, PARTIAL_REFRESH_MS);
+	  }
+  }
+
+  //Window covers every change made so far
+  if ((xs * 8) <= disp->dirtyX0 && (xe * 8 + 7) >= disp->dirtyX1 && y0 <= disp->dirtyY0 && y1 >= disp->dirtyY1)
+  {
+	  clearDirty(disp);
+  }
+
+  displaySleep(disp);
+}
+
+/*
+ * @brief	Sends a frame, or a band of rows of it, that is generated row by row while it is sent, without using the framebuffer.
+ * @note       { Rows are rendered into the two DMA staging buffers (DMA_CHUNK_SIZE / rowBytes rows at a time), so rendering
+ * 			one chunk overlaps with the transfer of the other. If display RAM still holds the previous frame sent this way, only
+ * 			rows y0 to y1 are sent (the RAM Y window is set to them, as #displayRegion does), the partial waveform is used and
+ * 			the band is rendered a second time after the refresh to update the other RAM bank. Otherwise (or with full set)
+ * 			the whole frame is sent with the full waveform. The controller is put into deep sleep afterwards }
+ * @param[(in)] <y0> { First row of the band (0 - height-1) }
+ * @param[(in)] <y1> { Last row of the band, clipped to height-1 }
+ * @param[(in)] <render> { Fills one row (rowBytes bytes) for row y. Rows are requested in order, once per pass }
+ * @param[(in)] <ctx> { Passed through to render }
+ * @param[(in)] <full> { 1 forces the full waveform (e.g. to clear ghosting after many partial updates) }
+ */
+void displayRows(ssd1608_t *disp, uint16_t y0, uint16_t y1, void (*render)(uint16_t y, uint8_t *row, void *ctx), void *ctx, int full)
+{
+  int partial;
+
+  panelReady(disp);
+  partial = (!full && disp->ram == RAM_STREAM);
+  if (!partial)
+  {
+	  y0 = 0;								//Rows outside the band are not in display RAM yet
+	  y1 = disp->height - 1;
+  }
+  if (y1 >= disp->height) y1 = disp->height - 1;
+  if (y0 > y1) return;
+
+  if (partial != disp->lutPartial)
+  {
+	  EPD_command1(disp, SSD1608_WRITE_LUT, partial ? LUT_PARTIAL : LUT_DATA, 30);
+	  disp->lutPartial = partial;
+  }
+
+  for (int pass = 0; pass <= partial; pass++)
+  {
+	  int stage = 0;
+
+	  setRAMWindow(disp, 0, disp->rowBytes - 1, y0, y1);
+	  setRAM(disp, 0, y0);
+	  writeRAM(disp);
+	  GPIO_OutSet(&disp->dc);
+
+	  for (uint16_t y = y0; y <= y1; )
+	  {
+		  uint8_t *buf = dma_stage[stage];
+		  int count = 0;
+		  while (count + disp->rowBytes <= DMA_CHUNK_SIZE && y <= y1)
+		  {
+			  render(y, &buf[count], ctx);
+			  count += disp->rowBytes;
+			  y++;
+		  }
+
+		  SPIwait();
+		  SPItransferAsync(disp, buf, count, NULL);
+		  stage ^= 1;
+	  }
+	  SPIwait();
+	  GPIO_OutSet(&disp->cs);
+
+	  if (pass == 0)
+	  {
+		  refreshScreen(disp, partial ? PARTIAL_REFRESH_MS : FULL_REFRESH_MS);
+	  }
+  }
+
+  disp->ram = RAM_STREAM;
+  displaySleep(disp);
+}
+
+/***** Pixel masks in display bit order (leftmost pixel = bit 7) *****/
+static const uint8_t pixelMask[8] = { 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01 };
+static const uint8_t leftMask[8] = { 0xFF, 0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0x03, 0x01 };		//Pixels from x to end of byte
+static const uint8_t rightMask[8] = { 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0xFE, 0xFF };		//Pixels from start of byte to x
+
+/*
+ * @brief	Sets or clears pixels xs to xe (inclusive) of one row. Whole bytes in between are written with memset.
+ * @note       { No range checks -- callers clip first. Works on a framebuffer row or on a row being streamed by #displayRows }
+ */
+void spanRow(uint8_t *row, int16_t xs, int16_t xe, int color)
+{
+  int first = xs >> 3;
+  int last = xe >> 3;
+  uint8_t mask;
+
+  if (first == last)
+  {
+	  mask = leftMask[xs & 7] & rightMask[xe & 7];
+	  row[first] = color ? (row[first] | mask) : (row[first] & ~mask);
+	  return;
+  }
+
+  mask = leftMask[xs & 7];
+  row[first] = color ? (row[first] | mask) : (row[first] & ~mask);
+
+  if (last - first > 1)
+  {
+	  memset(&row[first + 1], color ? 0xFF : 0x00, last - first - 1);
+  }
+
+  mask = rightMask[xe & 7];
+  row[last] = color ? (row[last] | mask) : (row[last] & ~mask);
+}
+
+/* @brief	Function used to edit screen buffer array and directly write edit individual pixels.
+ * @param[(in)] <x> { Desired X position of Pixel }
+ * @param[(in)] <y> { Desired Y position of Pixel }
+ * @param[(in)] <color> { Desired color value (White = 1 ; Black = 0) }
+ */
+
+void drawPixel(ssd1608_t *disp, int16_t x, int16_t y, int color)
+{
+  if(((uint16_t)x >= disp->width) || ((uint16_t)y >= disp->height)) return;		//Out of Range (negative values wrap high)
+  markDirty(disp, x, y, x, y);
+
+  uint8_t *p = &disp->fb[(y * disp->rowBytes) + (x >> 3)];
+  if(color)
+  {
+	  *p |= pixelMask[x & 7];
+  }
+  else
+  {
+	  *p &= ~pixelMask[x & 7];
+  }
+}
+
+/*
+ * @brief	Draw a horizontal line. Function will update values in the framebuffer
+ * @param[(in)] <x> { X position of left end }
+ * @param[(in)] <y> { Y position of line }
+ * @param[(in)] <w> { Length in pixels }
+ * @param[(in)] <color> { Line color (0 = black ; 1 = White) }
+ */
+void drawHLine(ssd1608_t *disp, int16_t x, int16_t y, int16_t w, int color)
+{
+  int16_t xe = x + w - 1;
+  if((w <= 0) || (y < 0) || (y >= disp->height) || (xe < 0) || (x >= disp->width)) return;		//Out of Range
+  if(x < 0) x = 0;
+  if(xe >= disp->width) xe = disp->width - 1;
+
+  markDirty(disp, x, y, xe, y);
+  spanRow(&disp->fb[y * disp->rowBytes], x, xe, color);
+}
+
+/*
+ * @brief	Draw a vertical line. Function will update values in the framebuffer
+ * @param[(in)] <x> { X position of line }
+ * @param[(in)] <y> { Y position of top end }
+ * @param[(in)] <h> { Length in pixels }
+ * @param[(in)] <color> { Line color (0 = black ; 1 = White) }
+ */
+void drawVLine(ssd1608_t *disp, int16_t x, int16_t y, int16_t h, int color)
+{
+  int16_t ye = y + h - 1;
+  if((h <= 0) || (x < 0) || (x >= disp->width) || (ye < 0) || (y >= disp->height)) return;		//Out of Range
+  if(y < 0) y = 0;
+  if(ye >= disp->height) ye = disp->height - 1;
+
+  markDirty(disp, x, y, x, ye);
+  uint8_t *p = &disp->fb[(y * disp->rowBytes) + (x >> 3)];
+  uint8_t mask = pixelMask[x & 7];
+  for(int16_t i = y; i <= ye; i++, p += disp->rowBytes)
+  {
+	  *p = color ? (*p | mask) : (*p & ~mask);
+  }
+}
+
+/*
+ * @brief	Fill a rectangle. Function will update values in the framebuffer
+ * @param[(in)] <x> { X position of left edge }
+ * @param[(in)] <y> { Y position of top edge }
+ * @param[(in)] <w> { Width in pixels }
+ * @param[(in)] <h> { Height in pixels }
+ * @param[(in)] <color> { Fill color (0 = black ; 1 = White) }
+ */
+void fillRect(ssd1608_t *disp, int16_t x, int16_t y, int16_t w, int16_t h, int color)
+{
+  int16_t xe = x + w - 1;
+  int16_t ye = y + h - 1;
+  if((w <= 0) || (h <= 0) || (xe < 0) || (ye < 0) || (x >= disp->width) || (y >= disp->height)) return;		//Out of Range
+  if(x < 0) x = 0;
+  if(y < 0) y = 0;
+  if(xe >= disp->width) xe = disp->width - 1;
+  if(ye >= disp->height) ye = disp->height - 1;
+
+  markDirty(disp, x, y, xe, ye);
+  for(int16_t i = y; i <= ye; i++)
+  {
+	  spanRow(&disp->fb[i * disp->rowBytes], x, xe, color);
+  }
+}
+
+/*
+ * @brief	Copies one row of glyph data into a row at any x position, clipped to the screen width
+ * @note       { Aligned rows are copied with memcpy, others are shifted into place one byte at a time. Works on a framebuffer row
+ * 			or on a row being streamed by #displayRows }
+ * @param[(in)] <row> { Destination row }
+ * @param[(in)] <rowBytes> { Bytes in the destination row }
+ * @param[(in)] <x> { X position of the left edge (may be negative) }
+ * @param[(in)] <line> { Source bytes, or NULL for a blank (0x00) row }
+ * @param[(in)] <width> { Source width in bytes }
+ */
+void blitRow(uint8_t *row, uint8_t rowBytes, int16_t x, const uint8_t *line, uint8_t width)
+{
+  int shift = x & 7;
+  int16_t xb = (x - shift) / 8;								//Byte column holding the left edge (may be negative)
+
+  if(shift == 0)
+  {
+	  int16_t c0 = (xb < 0) ? -xb : 0;
+	  int16_t c1 = (xb + width > rowBytes) ? (rowBytes - xb) : width;
+	  if(c1 <= c0) return;
+	  if(line != NULL)
+	  {
+		  memcpy(&row[xb + c0], &line[c0], c1 - c0);
+	  }
+	  else
+	  {
+		  memset(&row[xb + c0], 0x00, c1 - c0);
+	  }
+	  return;
+  }
+
+  uint8_t prev = 0;
+  for(int16_t c = 0; c <= width; c++)
+  {
+	  uint8_t cur = (line != NULL && c < width) ? line[c] : 0;
+	  uint8_t value = (uint8_t)((prev << (8 - shift)) | (cur >> shift));
+	  uint8_t mask = (c == 0) ? leftMask[shift] : ((c == width) ? (uint8_t)~leftMask[shift] : 0xFF);
+	  int16_t col = xb + c;
+	  if(col >= 0 && col < rowBytes)
+	  {
+		  row[col] = (row[col] & ~mask) | (value & mask);
+	  }
+	  prev = cur;
+  }
+}
+
+/*
+ * @brief	Copies a bitmap into the framebuffer, replacing every pixel of its box. Byte aligned boxes are copied with one
+ * 			memcpy per row, other positions shift each source byte across two buffer bytes.
+ * @param[(in)] <x> { X position of left edge }
+ * @param[(in)] <y> { Y position of top edge }
+ * @param[(in)] <src> { Bitmap rows in display bit order, or NULL for a blank (all 0) box }
+ * @param[(in)] <width> { Width in bytes }
+ * @param[(in)] <height> { Height in rows }
+ */
+static void blitRows(ssd1608_t *disp, int16_t x, int16_t y, const uint8_t *src, uint8_t width, uint8_t height)
+{
+  int16_t xe = x + (width * 8) - 1;
+  int16_t ye = y + height - 1;
+  if((width == 0) || (height == 0) || (xe < 0) || (ye < 0) || (x >= disp->width) || (y >= disp->height)) return;		//Out of Range
+
+  int16_t r0 = (y < 0) ? -y : 0;							//First glyph row on screen
+  int16_t r1 = (ye >= disp->height) ? (disp->height - 1 - y) : (height - 1);
+
+  markDirty(disp, (x < 0) ? 0 : x, y + r0, (xe >= disp->width) ? (disp->width - 1) : xe, y + r1);
+
+  for(int16_t r = r0; r <= r1; r++)
+  {
+	  uint8_t *row = &disp->fb[(y + r) * disp->rowBytes];
+	  const uint8_t *line = (src != NULL) ? &src[r * width] : NULL;
+
+	  blitRow(row, disp->rowBytes, x, line, width);
+  }
+}
+
+/*
+ * @brief	Draw a string by copying glyph rows from a font into the framebuffer. Each glyph replaces its whole box,
+ * 			so redrawing a string over an old one needs no clearing first.
+ * @note       { Characters the font does not contain are drawn as a blank box of font->blankWidth bytes }
+ * @param[(in)] <x> { X position of left edge (fastest when a multiple of 8) }
+ * @param[(in)] <y> { Y position of top edge }
+ * @param[(in)] <font> { Font to draw with }
+ * @param[(in)] <str> { Null terminated string }
+ * @return     { X position just right of the last glyph }
+ */
+int16_t drawString(ssd1608_t *disp, int16_t x, int16_t y, const font_t *font, const char *str)
+{
+  for(; *str != '\0'; str++)
+  {
+	  if((*str >= font->first) && (*str <= font->last))
+	  {
+		  const glyph_t *g = &font->glyphs[*str - font->first];
+		  blitRows(disp, x, y, g->bitmap, g->width, g->height);
+		  x += g->width * 8;
+	  }
+	  else
+	  {
+		  blitRows(disp, x, y, NULL, font->blankWidth, font->height);
+		  x += font->blankWidth * 8;
+	  }
+  }
+  return x;
+}
+
+/*
+ * @brief	Integer square root (floor)
+ * @param[(in)] <v> { Value to take the root of }
+ * @return     { floor(sqrt(v)), -1 for negative values }
+ */
+int16_t isqrt(int32_t v)
+{
+	int32_t r = 0;
+	int32_t bit = 1L << 30;
+
+	if (v < 0)
+	{
+		return -1;
+	}
+
+	while (bit > v)
+	{
+		bit >>= 2;
+	}
+	while (bit != 0)
+	{
+		if (v >= r + bit)
+		{
+			v -= r + bit;
+			r = (r >> 1) + bit;
+		}
+		else
+		{
+			r >>= 1;
+		}
+		bit >>= 2;
+	}
+	return r;
+}
+
+/*
+ * @brief	Bresenham kernel shared by #WriteLine and #drawThickLine. Walks the major axis from step n to nEnd and writes every run
+ * 			of pixels that share a minor coordinate in one go.
+ * @note       { steep and clip are passed as constants, so each call site gets its own copy of the loop with the other branches
+ * 			removed. Shallow runs are row spans (whole bytes with memset); steep runs step a pixel mask down the rows. With clip
+ * 			clear the caller has made sure every pixel, padding included, is on screen, so the loop does no range checks at all }
+ * @param[(in)] <a0> { Major axis coordinate of step 0 }
+ * @param[(in)] <b> { Minor axis coordinate at step n }
+ * @param[(in)] <bstep> { Minor axis direction (1 or -1) }
+ * @param[(in)] <da> { Major axis length }
+ * @param[(in)] <db> { Minor axis length }
+ * @param[(in)] <err> { Error term at step n }
+ * @param[(in)] <n> { First step to draw }
+ * @param[(in)] <nEnd> { Last step to draw }
+ * @param[(in)] <lo> { Pixels added before the line along the minor axis (thickness) }
+ * @param[(in)] <hi> { Pixels added after the line along the minor axis }
+ */
+static inline void lineKernel(ssd1608_t *disp, const int steep, const int clip, int16_t a0, int16_t b, int16_t bstep,
+							  int32_t da, int32_t db, int32_t err, int32_t n, int32_t nEnd, int16_t lo, int16_t hi, int color)
+{
+  int32_t run = n;
+  int16_t limit = steep ? disp->width : disp->height;		//Minor axis size
+
+  for (; n <= nEnd; n++)
+  {
+	  err -= db;
+	  if (err < 0 || n == nEnd)
+	  {
+		  int16_t s = b - lo;
+		  int16_t e = b + hi;
+		  if (clip)
+		  {
+			  if (s < 0) s = 0;
+			  if (e >= limit) e = limit - 1;
+		  }
+
+		  if (!steep)
+		  {
+			  for (int16_t y = s; y <= e; y++)
+			  {
+				  spanRow(&disp->fb[y * disp->rowBytes], a0 + run, a0 + n, color);
+			  }
+		  }
+		  else if (s == e)
+		  {
+			  uint8_t *p = &disp->fb[((a0 + run) * disp->rowBytes) + (s >> 3)];
+			  uint8_t mask = pixelMask[s & 7];
+			  for (int32_t i = run; i <= n; i++, p += disp->rowBytes)
+			  {
+				  *p = color ? (*p | mask) : (*p & ~mask);
+			  }
+		  }
+		  else if (s < e)
+		  {
+			  for (int32_t i = run; i <= n; i++)
+			  {
+				  spanRow(&disp->fb[(a0 + i) * disp->rowBytes], s, e, color);
+			  }
+		  }
+		  run = n + 1;
+	  }
+	  if (err < 0)
+	  {
+		  b += bstep;
+		  err += da;
+	  }
+  }
+}
+
+/*
+ * @brief	Draws a line with the minor axis widened to t pixels. Clipping is worked out once before the kernel runs.
+ * @note       { Steps before the first and after the last on-screen column (row, for steep lines) are skipped by computing the
+ * 			error term at the first visible step directly: after n steps the minor coordinate has moved
+ * 			k = ceil((n*db - da/2) / da) times. Lines that fit on screen with their padding use the kernel without range checks }
+ * @param[(in)] <t> { Pixels along the minor axis (1 = the same pixels as the Adafruit writeLine) }
+ */
+static void lineDraw(ssd1608_t *disp, int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t t, int color)
+{
+  int16_t hold;
+  int steep = abs(y1 - y0) > abs(x1 - x0);
+
+  if (steep)
+  {
+	  hold = x0; x0 = y0; y0 = hold;
+	  hold = x1; x1 = y1; y1 = hold;
+  }
+  if (x0 > x1)
+  {
+	  hold = x0; x0 = x1; x1 = hold;
+	  hold = y0; y0 = y1; y1 = hold;
+  }
+
+  int16_t majorLimit = steep ? disp->height : disp->width;
+  int16_t minorLimit = steep ? disp->width : disp->height;
+  int16_t lo = t / 2;
+  int16_t hi = (t - 1) / 2;
+  int16_t bstep = (y0 < y1) ? 1 : -1;
+  int32_t da = x1 - x0;
+  int32_t db = abs(y1 - y0);
+  int32_t n = (x0 < 0) ? -x0 : 0;
+  int32_t nEnd = (x1 >= majorLimit) ? (majorLimit - 1 - x0) : da;
+  int16_t bMin = ((y0 < y1) ? y0 : y1) - lo;
+  int16_t bMax = ((y0 < y1) ? y1 : y0) + hi;
+
+  if (n > nEnd || bMax < 0 || bMin >= minorLimit) return;		//Out of Range
+
+  //Jump straight to the first visible step
+  int32_t k = 0;
+  if (n > 0 && (n * db) > (da / 2))
+  {
+	  k = ((n * db) - (da / 2) + da - 1) / da;
+  }
+  int32_t err = (da / 2) - (n * db) + (k * da);
+  int16_t b = y0 + (bstep * k);
+
+  //One dirty box for the whole line
+  if (bMin < 0) bMin = 0;
+  if (bMax >= minorLimit) bMax = minorLimit - 1;
+  if (steep)
+  {
+	  markDirty(disp, bMin, x0 + n, bMax, x0 + nEnd);
+  }
+  else
+  {
+	  markDirty(disp, x0 + n, bMin, x0 + nEnd, bMax);
+  }
+
+  int clip = (((y0 < y1) ? y0 : y1) - lo < 0) || (((y0 < y1) ? y1 : y0) + hi >= minorLimit);
+  if (steep)
+  {
+	  if (clip) lineKernel(disp, 1, 1, x0, b, bstep, da, db, err, n, nEnd, lo, hi, color);
+	  else lineKernel(disp, 1, 0, x0, b, bstep, da, db, err, n, nEnd, lo, hi, color);
+  }
+  else
+  {
+	  if (clip) lineKernel(disp, 0, 1, x0, b, bstep, da, db, err, n, nEnd, lo, hi, color);
+	  else lineKernel(disp, 0, 0, x0, b, bstep, da, db, err, n, nEnd, lo, hi, color);
+  }
+}
+
+/*
+ * @brief	Draw a line between two designated points. Function will update values in the framebuffer
+ * @note       { Horizontal and vertical lines go straight to #drawHLine / #drawVLine. Other lines are clipped once and drawn by a
+ * 			kernel specialized for shallow or steep lines that writes whole runs of pixels at a time }
+ * @param[(in)] <x0> { X position of first point in line }
  * @param[(in)] <y0> { Y position of first point in line }
  * @param[(in)] <x1> { X position of second point in line }
  * @param[(in)] <y1> { Y position of second point in line }
  * @param[(in)] <color> { Line color (0 = black ; 1 = White) }
  */
-void WriteLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, int color)
+void WriteLine(ssd1608_t *disp, int16_t x0, int16_t y0, int16_t x1, int16_t y1, int color)
 {
-	int16_t steep = abs(y1 - y0) - abs(x1 - x0);
 	int16_t hold;
-	if (steep >= 1)
-	{
-		hold = x0;
-		x0 = y0;
-		y0 = hold;
-		hold = x1;
-        x1 = y1;
-        y1 = hold;
-	 }
+	if (y0 == y1)
+	{
+		if (x0 > x1) { hold = x0; x0 = x1; x1 = hold; }
+		drawHLine(disp, x0, y0, x1 - x0 + 1, color);
+		return;
+	}
+	if (x0 == x1)
+	{
+		if (y0 > y1) { hold = y0; y0 = y1; y1 = hold; }
+		drawVLine(disp, x0, y0, y1 - y0 + 1, color);
+		return;
+	}
+
+	lineDraw(disp, x0, y0, x1, y1, 1, color);
+}
+
+/*
+ * @brief	Draw a line of a given width, e.g. gauge needles and graph traces. Function will update values in the framebuffer
+ * @note       { The line is widened across its major axis, with the count scaled by length / major axis length so diagonal lines
+ * 			come out as wide as straight ones. A width of 1 draws the same pixels as #WriteLine }
+ * @param[(in)] <x0> { X position of first point in line }
+ * @param[(in)] <y0> { Y position of first point in line }
+ * @param[(in)] <x1> { X position of second point in line }
+ * @param[(in)] <y1> { Y position of second point in line }
+ * @param[(in)] <width> { Line width in pixels }
+ * @param[(in)] <color> { Line color (0 = black ; 1 = White) }
+ */
+void drawThickLine(ssd1608_t *disp, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t width, int color)
+{
+	int32_t dx = abs(x1 - x0);
+	int32_t dy = abs(y1 - y0);
+	int32_t da = (dx > dy) ? dx : dy;
+	int16_t t = width;
+
+	if (width == 0) return;
+	if (da > 0)
+	{
+		t = ((width * (int32_t)isqrt((dx * dx) + (dy * dy))) + (da / 2)) / da;
+	}
+	lineDraw(disp, x0, y0, x1, y1, t, color);
+}
+
+/*
+ * @brief	Draws one run of outline pixels in all eight octants of a circle
+ * @note       { clip is passed as a constant. Without it the spans go straight into the framebuffer; the caller has checked that
+ * 			the whole circle is on screen and marked it dirty }
+ * @param[(in)] <xa> { First offset of the run along the fast axis }
+ * @param[(in)] <xb> { Last offset of the run along the fast axis }
+ * @param[(in)] <y> { Offset along the slow axis }
+ */
+static inline void circleRuns(ssd1608_t *disp, const int clip, int16_t x0, int16_t y0, int16_t xa, int16_t xb, int16_t y, uint8_t color)
+{
+	if (clip)
+	{
+		drawHLine(disp, x0 + xa, y0 + y, xb - xa + 1, color);
+		drawHLine(disp, x0 - xb, y0 + y, xb - xa + 1, color);
+		drawHLine(disp, x0 + xa, y0 - y, xb - xa + 1, color);
+		drawHLine(disp, x0 - xb, y0 - y, xb - xa + 1, color);
+		drawVLine(disp, x0 + y, y0 + xa, xb - xa + 1, color);
+		drawVLine(disp, x0 - y, y0 + xa, xb - xa + 1, color);
+		drawVLine(disp, x0 + y, y0 - xb, xb - xa + 1, color);
+		drawVLine(disp, x0 - y, y0 - xb, xb - xa + 1, color);
+		return;
+	}
+
+	spanRow(&disp->fb[(y0 + y) * disp->rowBytes], x0 + xa, x0 + xb, color);
+	spanRow(&disp->fb[(y0 + y) * disp->rowBytes], x0 - xb, x0 - xa, color);
+	spanRow(&disp->fb[(y0 - y) * disp->rowBytes], x0 + xa, x0 + xb, color);
+	spanRow(&disp->fb[(y0 - y) * disp->rowBytes], x0 - xb, x0 - xa, color);
+	for (int16_t i = xa; i <= xb; i++)
+	{
+		uint8_t *lo = &disp->fb[(y0 + i) * disp->rowBytes];
+		uint8_t *hi = &disp->fb[(y0 - i) * disp->rowBytes];
+		uint8_t right = pixelMask[(x0 + y) & 7];
+		uint8_t left = pixelMask[(x0 - y) & 7];
+		lo[(x0 + y) >> 3] = color ? (lo[(x0 + y) >> 3] | right) : (lo[(x0 + y) >> 3] & ~right);
+		lo[(x0 - y) >> 3] = color ? (lo[(x0 - y) >> 3] | left) : (lo[(x0 - y) >> 3] & ~left);
+		hi[(x0 + y) >> 3] = color ? (hi[(x0 + y) >> 3] | right) : (hi[(x0 + y) >> 3] & ~right);
+		hi[(x0 - y) >> 3] = color ? (hi[(x0 - y) >> 3] | left) : (hi[(x0 - y) >> 3] & ~left);
+	}
+}
+
+/*
+ * @brief	Starts the midpoint walk of a circle
+ * @param[(in)] <w> { Walk state }
+ * @param[(in)] <r> { radius of circle }
+ */
+void circleBegin(circle_walk_t *w, uint8_t r)
+{
+	w->f = 1 - r;
+	w->ddF_x = 1;
+	w->ddF_y = -2 * r;
+	w->x = 0;
+	w->y = r;
+	w->run = 0;
+	w->done = 0;
+}
+
+/*
+ * @brief	Steps the midpoint walk to the end of the next run: the outline pixels (xa..xb, y) of one octant that share the
+ * 			same y. The other seven octants are the mirror images (+-x, +-y) and (+-y, +-x)
+ * @note       { Runs come out with xa rising and y falling. A streamed row can stop walking once both have passed it }
+ * @param[(in)] <w> { Walk state set up by #circleBegin }
+ * @param[(out)] <xa> { First offset of the run along the fast axis }
+ * @param[(out)] <xb> { Last offset of the run along the fast axis }
+ * @param[(out)] <y> { Offset along the slow axis }
+ * @return     { 1 if a run was returned, 0 once the walk is over }
+ */
+int circleNext(circle_walk_t *w, int16_t *xa, int16_t *xb, int16_t *y)
+{
+	if (w->done)
+	{
+		return 0;
+	}
 
-	    if (x0 > x1) {
-			hold = x0;
-			x0 = x1;
-			x1 = hold;
-			hold = y1;
-	        y1 = y0;
-	        y0 = hold;
-	    }
-
-	    int16_t dx, dy;
-	    dx = x1 - x0;
-	    dy = abs(y1 - y0);
-
-	    int16_t err = dx / 2;
-	    int16_t ystep;
-
-	    if (y0 < y1) {
-	        ystep = 1;
-	    } else {
-	        ystep = -1;
-	    }
-
-	    for (; x0<=x1; x0++) {
-	        if (steep >= 1) {
-	            drawPixel(y0, x0, color);
-	        }
-	        else {
-	            drawPixel(x0, y0, color);
-	        }
-	        err -= dy;
-	        if (err < 0) {
-	            y0 += ystep;
-	            err += dx;
-	        }
-	    }
-}
-
-/*
- * @brief	Draw a Circle based on center and radius. Function will update buffer1
+	while (w->x < w->y)
+	{
+		int step = (w->f >= 0);
+		if (step)
+		{
+			*xa = w->run;
+			*xb = w->x;
+			*y = w->y;
+			w->run = w->x + 1;
+			w->y--;
+			w->ddF_y += 2;
+			w->f += w->ddF_y;
+		}
+		w->x++;
+		w->ddF_x += 2;
+		w->f += w->ddF_x;
+		if (step)
+		{
+			return 1;
+		}
+	}
+
+	*xa = w->run;
+	*xb = w->x;
+	*y = w->y;
+	w->done = 1;
+	return 1;
+}
+
+/*
+ * @brief	Outline of #drawCircle from the midpoint runs, one copy with and one without clipping
+ */
+static inline void circleKernel(ssd1608_t *disp, const int clip, int16_t x0, int16_t y0, uint8_t r, uint8_t color)
+{
+	circle_walk_t w;
+	int16_t xa, xb, y;
+
+	circleBegin(&w, r);
+	while (circleNext(&w, &xa, &xb, &y))
+	{
+		circleRuns(disp, clip, x0, y0, xa, xb, y, color);
+	}
+}
+
+/*
+ * @brief	Reports whether a circle lies completely on screen, so it can be drawn without range checks
+ */
+static int circleInside(ssd1608_t *disp, int16_t x0, int16_t y0, uint8_t r)
+{
+	return (x0 - r >= 0) && (y0 - r >= 0) && (x0 + r < disp->width) && (y0 + r < disp->height);
+}
+
+/*
+ * @brief	Draw a Circle based on center and radius. Function will update the framebuffer
+ * @note       { Outline pixels that share a row (or column) are collected and drawn as one span. Circles that are completely on
+ * 			screen are marked dirty once and drawn without range checks }
  * @param[(in)] <x0> { X component of circle center }
  * @param[(in)] <y0> { Y component of circle center }
  * @param[(in)] <r> { radius of circle }
  * @param[(in)] <color> { Circle color (0 = black ; 1 = White) }
  */
-void drawCircle (uint8_t x0, uint8_t y0,uint8_t r, uint8_t color)
-{
-		int16_t f = 1 - r;
-	    int16_t ddF_x = 1;
-	    int16_t ddF_y = -2 * r;
-	    int16_t x = 0;
-	    int16_t y = r;
-
-
-	    drawPixel(x0  , y0+r, color);
-	    drawPixel(x0  , y0-r, color);
-	    drawPixel(x0+r, y0  , color);
-	    drawPixel(x0-r, y0  , color);
-
-	    while (x<y) {
-	        if (f >= 0) {
-	            y--;
-	            ddF_y += 2;
-	            f += ddF_y;
-	        }
-	        x++;
-	        ddF_x += 2;
-	        f += ddF_x;
-
-	        drawPixel(x0 + x, y0 + y, color);
-	        drawPixel(x0 - x, y0 + y, color);
-	        drawPixel(x0 + x, y0 - y, color);
-	        drawPixel(x0 - x, y0 - y, color);
-	        drawPixel(x0 + y, y0 + x, color);
-	        drawPixel(x0 - y, y0 + x, color);
-	        drawPixel(x0 + y, y0 - x, color);
-	        drawPixel(x0 - y, y0 - x, color);
-	    }
+void drawCircle(ssd1608_t *disp, int16_t x0, int16_t y0, uint8_t r, uint8_t color)
+{
+	if (circleInside(disp, x0, y0, r))
+	{
+		markDirty(disp, x0 - r, y0 - r, x0 + r, y0 + r);
+		circleKernel(disp, 0, x0, y0, r, color);
+	}
+	else
+	{
+		circleKernel(disp, 1, x0, y0, r, color);
+	}
+}
+
+/*
+ * @brief	Sets or clears one row of a filled circle
+ */
+static inline void fillSpan(ssd1608_t *disp, const int clip, int16_t xs, int16_t xe, int16_t y, uint8_t color)
+{
+	if (clip)
+	{
+		drawHLine(disp, xs, y, xe - xs + 1, color);
+	}
+	else
+	{
+		spanRow(&disp->fb[y * disp->rowBytes], xs, xe, color);
+	}
+}
+
+/*
+ * @brief	Fill of #fillCircle from the midpoint runs. A run (xa..xb, y) bounds rows y0 +- y at half width xb and rows
+ * 			y0 +- xa..xb at half width y
+ */
+static inline void fillCircleKernel(ssd1608_t *disp, const int clip, int16_t x0, int16_t y0, uint8_t r, uint8_t color)
+{
+	circle_walk_t w;
+	int16_t xa, xb, y;
+
+	circleBegin(&w, r);
+	while (circleNext(&w, &xa, &xb, &y))
+	{
+		fillSpan(disp, clip, x0 - xb, x0 + xb, y0 + y, color);
+		fillSpan(disp, clip, x0 - xb, x0 + xb, y0 - y, color);
+		for (int16_t i = xa; i <= xb; i++)
+		{
+			fillSpan(disp, clip, x0 - y, x0 + y, y0 + i, color);
+			if (i != 0)
+			{
+				fillSpan(disp, clip, x0 - y, x0 + y, y0 - i, color);
+			}
+		}
+	}
+}
+
+/*
+ * @brief	Draw a filled circle based on center and radius, e.g. gauge hubs and graph markers. Function will update the framebuffer
+ * @note       { Covers the same pixels as the Adafruit fillCircle. Each row is written as one span (whole bytes with memset) }
+ * @param[(in)] <x0> { X component of circle center }
+ * @param[(in)] <y0> { Y component of circle center }
+ * @param[(in)] <r> { radius of circle }
+ * @param[(in)] <color> { Fill color (0 = black ; 1 = White) }
+ */
+void fillCircle(ssd1608_t *disp, int16_t x0, int16_t y0, uint8_t r, uint8_t color)
+{
+	if (circleInside(disp, x0, y0, r))
+	{
+		markDirty(disp, x0 - r, y0 - r, x0 + r, y0 + r);
+		fillCircleKernel(disp, 0, x0, y0, r, color);
+	}
+	else
+	{
+		fillCircleKernel(disp, 1, x0, y0, r, color);
+	}
 }
@@ -106,6 +106,9 @@
 #include "spi.h"
 #include "gpio.h"
 #include "board.h"
+#include "dma.h"
+#include "lp.h"
+#include "NVIC_table.h"
 
 /**** Display Addresses ****/
 #define SSD1608_SW_RESET 	0x12
@@ -123,32 +126,182 @@
 #define SSD1608_SET_RAMYCOUNT 0x4F
 #define SSD1608_DISP_CTRL2 0x22
 #define SSD1608_MASTER_ACTIVATE 0x20
+#define SSD1608_DEEP_SLEEP 0x10
 
-/***** Enable Pin Decelerations *****/
+/***** Enable Pin Decelerations (EV kit wiring, see #SSD1608_EVKIT_PANEL) *****/
 #define 	DC_SEL			PIN_8		//Data/Communications
  #define 	RST				PIN_9		//Reset
  #define 	CS				PIN_10		//Chip Select
  #define 	EN				PIN_11		//Enable
+ #define 	BUSY			PIN_13		//Busy (input, high while the panel is running a command or waveform)
  #define  	GPIO_PORT       PORT_0
 
 /***** General Definitions *****/
-#define ARRAY_SIZE	5000		//Total array size to modify screen
+#define ARRAY_SIZE	5000		//Framebuffer size of the 1.54" panel
+#define SCREEN_WIDTH	200			//Pixels per row of the 1.54" panel
+#define SCREEN_HEIGHT	200			//Rows of the 1.54" panel
+#define ROW_BYTES		25			//Bytes per row of the 1.54" panel
+#define SSD1608_MAX_ROW_BYTES	30	//Widest panel the driver supports (240 pixels, the SSD1608 source count)
+#define FULL_REFRESH_MS		2000	//Full waveform duration
+#define PARTIAL_REFRESH_MS	500		//Partial waveform duration (see LUT_PARTIAL)
+#define RESET_WAIT_MS		500		//Worst case reset time, used when BUSY is not connected
+#define SSD1608_SLEEP_KEEPS_RAM	1	//Display RAM survives deep sleep. Set to 0 to resend the whole buffer after every wake
+
+/***** BUSY / Wait Timer Config *****/
+#define BUSY_TMR			MXC_TMR1	//One-shot timer used for sleeping delays (MXC_TMR0 is left to the application)
+#define BUSY_TMR_IRQ		TMR1_IRQn
+#define XFER_TMR			MXC_TMR2	//Free running timer that measures display RAM writes (see xferUs)
 
 /***** SPI Config *****/
  #define SPI0_A
- #define SPI 			SPI0A
+ #define SPI 			SPI0A		//Instance of the EV kit panel
  #define SPI_IRQ 		SPI0_IRQn
- #define SPI_SPEED      500000  // Bit Rate
+ #define SPI_SPEED      500000  // Bit Rate for commands and read back
+ #define SPI_RAM_SPEED	20000000	//Highest bit rate #SPIlinkTune tries for display RAM writes (SSD1608 write clock limit)
+ #define SPI_INSTANCES	3		//SPI0A, SPI1A and SPI1B
+
+/***** SPI DMA Config *****/
+ #define SPI_REGS		MXC_SPI17Y			//Register block behind SPI0A, used for DMA-fed transactions
+ #define SPI_DMA_REQSEL	DMA_REQSEL_SPI0TX
+ #define SPI_DMA_LEVEL	8					//TX FIFO level (bytes free) that requests a DMA burst
+ #define DMA_CHUNK_SIZE	250					//Bytes per DMA chunk when window rows are packed before sending
+
+/***** Types *****/
+typedef struct {
+	uint32_t transactions;		//Number of SPI transactions started
+	uint32_t bytes;				//Number of bytes clocked out to the display
+	uint32_t commands;			//Number of command bytes (DC low) sent to the controller
+} spi_stats_t;
+
+typedef struct {
+	const uint8_t *bitmap;		//Glyph rows, 'width' bytes each, in display bit order
+	uint8_t width;				//Glyph width in bytes
+	uint8_t height;				//Glyph height in rows
+} glyph_t;
+
+typedef struct {
+	const glyph_t *glyphs;		//One entry per character from 'first' to 'last'
+	char first;					//First character in the font
+	char last;					//Last character in the font
+	uint8_t blankWidth;			//Width in bytes of the blank cell drawn for characters not in the font
+	uint8_t height;				//Rows of the blank cell
+} font_t;
+
+typedef struct {
+	const uint8_t *src;			//Next compressed byte
+	const uint8_t *end;			//End of compressed data
+	uint8_t count;				//Bytes left in the current PackBits run
+	uint8_t repeat;				//Current run repeats 'value' (otherwise literal bytes follow in src)
+	uint8_t value;				//Byte being repeated
+	uint8_t col;				//Column (byte) of the next output byte in its row
+	uint8_t rowBytes;			//Bytes per row of the bitmap
+	uint8_t row[SSD1608_MAX_ROW_BYTES];		//Last decoded row, XORed into the next one
+} rle_stream_t;
+
+typedef struct {
+	int16_t f;					//Midpoint decision variable
+	int16_t ddF_x;
+	int16_t ddF_y;
+	int16_t x;					//Offset along the fast axis
+	int16_t y;					//Offset along the slow axis
+	int16_t run;				//First x offset plotted at the current y
+	uint8_t done;				//Last run has been returned
+} circle_walk_t;
+
+typedef struct {
+	uint8_t cmd;				//Command byte
+	uint8_t len;				//Payload bytes
+	uint16_t delay;				//Wait after the entry in ms, | SSD1608_SEQ_BUSY to wait for BUSY instead (delay = fallback time)
+	const uint8_t *data;		//Payload, sent straight from here. NULL for 0x01, 0x44 and 0x45 sends the panel's geometry
+} ssd1608_seq_t;
+
+#define SSD1608_SEQ_BUSY	0x8000		//Entry waits for BUSY to drop
+#define SSD1608_SEQ_END		0xFFFF		//Delay of the entry that ends a sequence
+
+#define GEOMETRY_DRIVER		0			//Offsets of the driver output and RAM window payloads in ssd1608_t.geometry
+#define GEOMETRY_RAMX		3
+#define GEOMETRY_RAMY		5
+#define GEOMETRY_SIZE		9
+
+typedef enum {
+	PANEL_OFF,					//EN low, nothing retained
+	PANEL_READY,				//Powered and configured, accepts commands
+	PANEL_SLEEP					//Deep sleep, registers lost, RAM kept (see SSD1608_SLEEP_KEEPS_RAM)
+} panel_state_t;
+
+typedef enum {
+	RAM_NONE,					//Display RAM content unknown
+	RAM_FRAMEBUFFER,			//Display RAM matches the framebuffer apart from the dirty region
+	RAM_STREAM					//Display RAM holds the last frame sent by #displayRows
+} ram_contents_t;
+
+/*
+ * One SSD1608 panel. Fill in the configuration part (see #SSD1608_EVKIT_PANEL) and call #SPIinit and #pinInit once;
+ * the rest is driver state.
+ */
+typedef struct ssd1608 {
+	/* Configuration */
+	uint16_t width;				//Pixels per row (at most SSD1608_MAX_ROW_BYTES * 8)
+	uint16_t height;			//Rows (gate lines)
+	spi_type spi;				//SPI instance the panel is on. Only SPI0A transfers are fed by DMA
+	uint32_t speed;				//SPI bit rate for commands (and reading display RAM)
+	uint32_t ramSpeed;			//Highest SPI bit rate #SPIlinkTune tries for display RAM writes
+	uint32_t port;				//GPIO port of the control pins
+	uint32_t csPin;				//Chip select
+	uint32_t dcPin;				//Data/Command
+	uint32_t rstPin;			//Reset
+	uint32_t enPin;				//Supply enable
+	uint32_t busyPin;			//BUSY input, 0 if not connected (fixed waits on BUSY_TMR instead)
+	uint8_t *fb;				//Framebuffer, rowBytes * height bytes
+	const ssd1608_seq_t *initSeq;	//Configuration sent after every reset. Entries with a NULL payload for the driver output
+									//and RAM window commands get the gate count and window from width and height
+
+	/* Driver state, set up by #pinInit */
+	uint8_t rowBytes;			//Bytes per row in fb and in display RAM
+	uint8_t geometry[GEOMETRY_SIZE];	//Driver output, RAM X and RAM Y payloads for this panel's size
+	gpio_cfg_t cs;
+	gpio_cfg_t dc;
+	gpio_cfg_t en;
+	gpio_cfg_t rst;
+	gpio_cfg_t busy;
+	panel_state_t state;		//Controller power state
+	ram_contents_t ram;			//What display RAM holds
+	uint8_t lutPartial;			//Partial waveform is loaded
+	uint32_t linkHz;			//Bit rate display RAM is written at, found by #SPIlinkTune (0 = not tuned, writes use speed)
+	uint32_t xferUs;			//Measured time of the last display RAM write in microseconds
+	uint8_t xferRunning;		//XFER_TMR is timing a display RAM write
+	volatile int busyWait;		//Set while a reset, power-up delay or waveform started by the driver is running
+	void (*busyCb)(struct ssd1608 *disp);		//Completion callback for the wait in flight
+	struct ssd1608 *tmrNext;	//Next panel queued for BUSY_TMR behind this one
+	unsigned int tmrMs;			//Length of this panel's timed wait
+	int16_t dirtyX0;			//Box around framebuffer changes not yet sent (empty when x0 > x1)
+	int16_t dirtyY0;
+	int16_t dirtyX1;
+	int16_t dirtyY1;
+} ssd1608_t;
 
-/***** Variables *****/
-volatile int spi_flag;
-uint8_t buffer1[5000];		//Screen Update Buffer
+/* Configuration of the 1.54" panel wired to the MAX32660 EV kit as in the pin definitions above */
+#define SSD1608_EVKIT_PANEL(framebuffer)	{	\
+	.width = SCREEN_WIDTH,						\
+	.height = SCREEN_HEIGHT,					\
+	.spi = SPI,									\
+	.speed = SPI_SPEED,							\
+	.ramSpeed = SPI_RAM_SPEED,					\
+	.port = GPIO_PORT,							\
+	.csPin = CS,								\
+	.dcPin = DC_SEL,							\
+	.rstPin = RST,								\
+	.enPin = EN,								\
+	.busyPin = BUSY,							\
+	.fb = (framebuffer),						\
+	.initSeq = ssd1608_init_154					\
+}
 
-/***** Enable GPIO Structure Decelerations *****/
-gpio_cfg_t	cs;
-gpio_cfg_t	dc;
-gpio_cfg_t	en;
-gpio_cfg_t	rst;
+/***** Variables (defined in SSD1608_Display.c) *****/
+extern volatile int spi_flag;
+extern spi_stats_t spi_stats;	//Running SPI traffic counters, see #SPIstatsReset
+extern void (*spi_trace)(int dc, const uint8_t *data, uint16_t len);	//Optional tap on every transfer (e.g. a controller model on the host)
+extern const ssd1608_seq_t ssd1608_init_154[];	//Configuration of the 1.54" panel, sized by the panel's width and height
 
 /**
  * @brief Eclipse Library for implementing the
@@ -164,8 +317,9 @@ gpio_cfg_t	rst;
  * seperate .h file using the tutorial found under "Modification" section:
  *
  * 		https://www.hackster.io/thomas-lyp/human-body-temperature-to-e-ink-display-part-1-8d2500 
- * 		*NOTE - When using LUT and importing data from GIMP, make sure to use function
- *		"BitMapTransfer" to send data. GIMP exports data with bits in reverse order
+ * 		*NOTE - When using LUT and importing data from GIMP, convert the export with
+ *		tools/xbm2lut.py first. GIMP exports data with bits in reverse order, while
+ *		the framebuffer and "BitMapTransfer" use display order (leftmost pixel in bit 7)
  * 
  * @code
  *
@@ -174,72 +328,88 @@ gpio_cfg_t	rst;
  * #include <stdint.h>
  * #include "SSD1608_Display.h"
  *
+ * //Framebuffer and configuration of one panel. A second panel gets its own pair with its own pins
+ * static uint8_t fb[ARRAY_SIZE];
+ * static ssd1608_t display = SSD1608_EVKIT_PANEL(fb);
+ *
  * int main(void)
  * {
  *	printf("Program Start\n");
- *	SPIinit();
+ *	SPIinit(&display);
  *
  *	//Initialize Enables
- *	pinInit ();
+ *	pinInit (&display);
  *	printf("Pins initialized\n");
  *
- *	ClearBuffer();
+ *	//Pick the display RAM bit rate (display.linkHz), display.xferUs then holds the time of each frame's RAM write
+ *	SPIlinkTune(&display);
+ *
+ *	ClearBuffer(&display);
  *
  *	// Draw Checkerboard
  *	for(int i=0;i<200;i+=4)
  *	{
- *		WriteLine(i,0,i,200,0);
+ *		WriteLine(&display, i,0,i,200,0);
  *		printf("Writing line from 0,0 to %i , 200\n", i);
  *	}
  *	for(int j=0;j<200;j+=4)
  *	{
- *		WriteLine(200,j,0,j,0);
+ *		WriteLine(&display, 200,j,0,j,0);
  *		printf("Line from 200 , 200 to %d , 0\n", j);
  *  }
- *	displayScreen();
+ *	displayScreen(&display);
  *
- *	ClearBuffer();
+ *	ClearBuffer(&display);
  *
  *	// Draw diagonal lines
  *	for(int i=0;i<200;i+=4)
  *		{
- *			WriteLine(i,0,200,200,0);
+ *			WriteLine(&display, i,0,200,200,0);
  *			printf("Writing line from 0,0 to %i , 200\n", i);
  *		}
  *		for(int j=0;j<200;j+=4)
  * 		{
- *			WriteLine(0,200,j,0,0);
+ *			WriteLine(&display, 0,200,j,0,0);
  *			printf("Line from 200 , 200 to %d , 0\n", j);
  *		}
  *
- *	displayScreen();
+ *	displayScreen(&display);
  *
  *
- *	ClearBuffer();
+ *	ClearBuffer(&display);
  *
  *	// Draw a Starfish
- *	WriteLine(180,10,140,95,0);
- *	WriteLine(140,95,180,150,0);
- *	WriteLine(180,150,140,130,0);
- *	WriteLine(140,130,100,190,0);
- *	WriteLine(60,130,100,190,0);
- *	WriteLine(20,150,60,130,0);
- *	WriteLine(60,95,20,150,0);
- *	WriteLine(20,10,60,95,0);
- *	WriteLine(100,70,20,10,0);
- *	WriteLine(180,10,100,70,0);
+ *	WriteLine(&display, 180,10,140,95,0);
+ *	WriteLine(&display, 140,95,180,150,0);
+ *	WriteLine(&display, 180,150,140,130,0);
+ *	WriteLine(&display, 140,130,100,190,0);
+ *	WriteLine(&display, 60,130,100,190,0);
+ *	WriteLine(&display, 20,150,60,130,0);
+ *	WriteLine(&display, 60,95,20,150,0);
+ *	WriteLine(&display, 20,10,60,95,0);
+ *	WriteLine(&display, 100,70,20,10,0);
+ *	WriteLine(&display, 180,10,100,70,0);
+ *
+ *	drawCircle(&display, 100,140,10,0);
+ *	drawCircle(&display, 90,165,2,0);
+ *	drawCircle(&display, 90,165,1,0);
+ *	drawCircle(&display, 90,165,3,0);
+ *	drawCircle(&display, 110,165,1,0);
+ *	drawCircle(&display, 110,165,2,0);
+ *	drawCircle(&display, 110,165,3,0);
+ *	drawCircle(&display, 110,165,6,0);
+ *	drawCircle(&display, 90,165,6,0);
+ *
+ *	displayScreen(&display);
+ *
+ *	ClearBuffer(&display);
  *
- *	drawCircle (100,140,10,0);
- *	drawCircle(90,165,2,0);
- *	drawCircle(90,165,1,0);
- *	drawCircle(90,165,3,0);
- *	drawCircle(110,165,1,0);
- *	drawCircle(110,165,2,0);
- *	drawCircle(110,165,3,0);
- *	drawCircle(110,165,6,0);
- *	drawCircle(90,165,6,0);
+ *	// Draw a gauge: 3 pixel needle on a filled hub
+ *	drawCircle(&display, 100,100,90,0);
+ *	drawThickLine(&display, 100,100,40,40,3,0);
+ *	fillCircle(&display, 100,100,8,0);
  *
- *	displayScreen();
+ *	displayScreen(&display);
  *
  *	return (0);
  * }
@@ -254,61 +424,212 @@ gpio_cfg_t	rst;
 /**
  * @brief	Initialize SPI protocol on MAX32660. Initial setup uses P0_6 (SCK), P0_5 (MOSI), and P0_4 (MISO)
  */
-void SPIinit(void);
+void SPIinit(ssd1608_t *disp);
+
+/**
+ * @brief	Finds the highest bit rate display RAM writes read back correctly at. The result is in disp->linkHz
+ */
+int SPIlinkTune(ssd1608_t *disp);
+
+/**
+ * @brief	Starts a DMA-fed SPI transaction and returns immediately. Callback runs from interrupt once the last byte is on the wire
+ */
+int SPItransferAsync(ssd1608_t *disp, const uint8_t *info, uint16_t len, void (*callback)(int error));
+
+/**
+ * @brief	Sleeps the core until the SPI transaction started by #SPItransferAsync has completed
+ */
+void SPIwait(void);
+
+/**
+ * @brief	Sends out data via SPI protocol with SPI0A pins (blocking)
+ */
+void SPItransfer(ssd1608_t *disp, const uint8_t *info, uint16_t len);
+
+/**
+ * @brief	Zeroes the SPI traffic counters, e.g. before measuring one frame
+ */
+void SPIstatsReset(void);
+
+/**
+ * @brief	Clears out the framebuffer holding new screen data
+ */
+void ClearBuffer(ssd1608_t *disp);
+
+/**
+ * @brief	Grows the dirty region so it covers the given rectangle. Call after writing the framebuffer directly
+ */
+void markDirty(ssd1608_t *disp, int16_t x0, int16_t y0, int16_t x1, int16_t y1);
 
 /**
- * @brief	Clears out buffer1 array holding new screen data
+ * @brief	Reports whether the framebuffer has changed since it was last sent to the screen
  */
-void ClearBuffer(void);
+int isDirty(ssd1608_t *disp);
 
 /**
  * @brief	Initialize Enable Pins
  */
- void pinInit(void);
+ void pinInit(ssd1608_t *disp);
 
 /**
  * @brief	Master Refresh command -- Transitions display
  */
-void updateScreen (void);
+void updateScreen (ssd1608_t *disp);
 
 /**
- * @brief	Sends new screen information by reversing every 8 bits (Gimp exports bitmaps least significant bit first, but display accepts most significant first)
+ * @brief	Starts a full refresh and returns immediately. Callback runs from interrupt once the panel is idle again
  */
-void BitMapTransfer(uint8_t *Design, int len);
+int updateScreenAsync(ssd1608_t *disp, void (*callback)(ssd1608_t *disp));
 
 /**
- * @brief	Sends all of buffer1 data to screen, and then refreshes display
+ * @brief	Sends a table of commands without blocking, each entry chained from the interrupt that ends the one before
  */
-void displayScreen(void);
+int runSequence(ssd1608_t *disp, const ssd1608_seq_t *seq, void (*callback)(ssd1608_t *disp));
+
+/**
+ * @brief	Reports whether a refresh or reset started by the driver is still running on the panel
+ */
+int displayBusy(ssd1608_t *disp);
+
+/**
+ * @brief	Sleeps the core until the panel is idle
+ */
+void displayWait(ssd1608_t *disp);
+
+/**
+ * @brief	Puts the controller into deep sleep. The next update wakes it with a hardware reset instead of a full bring-up
+ */
+void displaySleep(ssd1608_t *disp);
+
+/**
+ * @brief	Cuts power to the display. The image stays on the panel but display RAM is lost
+ */
+void powerDown(ssd1608_t *disp);
+
+/**
+ * @brief	Sends bitmap data (display bit order) to display RAM in one DMA transaction
+ */
+void BitMapTransfer(ssd1608_t *disp, const uint8_t *Design, int len);
+
+/**
+ * @brief	Starts decoding a compressed bitmap (row XOR-delta + PackBits, see tools/lut2rle.py)
+ */
+void RLEbegin(rle_stream_t *s, const uint8_t *src, uint16_t size, uint8_t rowBytes);
+
+/**
+ * @brief	Decodes up to len bytes from a compressed bitmap. Returns the number of bytes written to dst
+ */
+uint16_t RLEread(rle_stream_t *s, uint8_t *dst, uint16_t len);
+
+/**
+ * @brief	Expands a compressed bitmap into a buffer (e.g. the framebuffer)
+ */
+void RLEdecode(uint8_t *dst, const uint8_t *src, uint16_t size, uint16_t len, uint8_t rowBytes);
+
+/**
+ * @brief	Decodes a compressed bitmap straight into the SPI DMA staging buffers and sends it to display RAM
+ */
+void BitMapTransferRLE(ssd1608_t *disp, const uint8_t *src, uint16_t size, int len);
+
+/**
+ * @brief	Sends the framebuffer changes to screen (whole buffer the first time), and then refreshes display. Does nothing if the framebuffer is unchanged
+ */
+void displayScreen(ssd1608_t *disp);
+
+/**
+ * @brief	Sends only a rectangle of the framebuffer to the screen and refreshes it with the partial-update waveform
+ */
+void displayRegion(ssd1608_t *disp, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+
+/**
+ * @brief	Sends a frame (or rows y0 to y1 of it once display RAM holds the previous one) rendered row by row during the
+ * transfer (no framebuffer), see SSD1608_Stream.h
+ */
+void displayRows(ssd1608_t *disp, uint16_t y0, uint16_t y1, void (*render)(uint16_t y, uint8_t *row, void *ctx), void *ctx, int full);
+
+/**
+ * @brief	Sets or clears pixels xs to xe (inclusive) of one row buffer. No clipping
+ */
+void spanRow(uint8_t *row, int16_t xs, int16_t xe, int color);
+
+/**
+ * @brief	Copies one row of glyph data into a row buffer at any x position, clipped to the row
+ */
+void blitRow(uint8_t *row, uint8_t rowBytes, int16_t x, const uint8_t *line, uint8_t width);
 
 /**
  * @brief	Function used to edit screen buffer array and directly write in pixels.
  */
-void drawPixel(int16_t x, int16_t y, int color);
+void drawPixel(ssd1608_t *disp, int16_t x, int16_t y, int color);
 
 /**
- * @brief	Draw a line between two points
+ * @brief	Draw a horizontal line, writing whole bytes where possible
  */
-void WriteLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, int color);
+void drawHLine(ssd1608_t *disp, int16_t x, int16_t y, int16_t w, int color);
+
+/**
+ * @brief	Draw a vertical line
+ */
+void drawVLine(ssd1608_t *disp, int16_t x, int16_t y, int16_t h, int color);
+
+/**
+ * @brief	Fill a rectangle, writing whole bytes where possible
+ */
+void fillRect(ssd1608_t *disp, int16_t x, int16_t y, int16_t w, int16_t h, int color);
+
+/**
+ * @brief	Draw a string by copying glyph rows from a font into the framebuffer
+ */
+int16_t drawString(ssd1608_t *disp, int16_t x, int16_t y, const font_t *font, const char *str);
+
+/**
+ * @brief	Integer square root (floor), -1 for negative values
+ */
+int16_t isqrt(int32_t v);
+
+/**
+ * @brief	Draw a line between two points, clipped to the screen
+ */
+void WriteLine(ssd1608_t *disp, int16_t x0, int16_t y0, int16_t x1, int16_t y1, int color);
+
+/**
+ * @brief	Draw a line of a given width in pixels, clipped to the screen
+ */
+void drawThickLine(ssd1608_t *disp, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t width, int color);
+
+/**
+ * @brief	Starts the midpoint walk of a circle of radius r (see #circleNext)
+ */
+void circleBegin(circle_walk_t *w, uint8_t r);
+
+/**
+ * @brief	Returns the next run of one octant of the circle outline. #drawCircle, #fillCircle and the streamed circles all draw from these runs
+ */
+int circleNext(circle_walk_t *w, int16_t *xa, int16_t *xb, int16_t *y);
 
 /**
  * @brief	Draw a Circle based on center and radius
  */
-void drawCircle (uint8_t x0, uint8_t y0,uint8_t r, uint8_t color);
+void drawCircle (ssd1608_t *disp, int16_t x0, int16_t y0, uint8_t r, uint8_t color);
+
+/**
+ * @brief	Draw a filled circle based on center and radius
+ */
+void fillCircle(ssd1608_t *disp, int16_t x0, int16_t y0, uint8_t r, uint8_t color);
 
 /**
- * @brief	Boot-up the e-ink display. Runs basic startup commands based on display module's data sheet
+ * @brief	Boot-up the e-ink display (or wake it from deep sleep) before writing display RAM directly
  */
-void powerUp(void);
+void powerUp(ssd1608_t *disp);
 
 /**
  * @brief	Set display's RAM address pointer
  */
-void setRAM (uint16_t x, uint16_t y);
+void setRAM (ssd1608_t *disp, uint16_t x, uint16_t y);
 
 /**
  * @brief	Sends address to configure RAM
  */
-void writeRAM();
+void writeRAM(ssd1608_t *disp);
 
 #endif /* SSD1608_DISPLAY_H_ */
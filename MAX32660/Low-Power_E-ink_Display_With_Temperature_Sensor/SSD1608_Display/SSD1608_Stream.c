@@ -0,0 +1,499 @@
+/*******************************************************************************
+* Copyright (C) Maxim Integrated Products, Inc., All rights Reserved.
+* 
+* This software is protected by copyright laws of the United States and
+* of foreign countries. This material may also be protected by patent laws
+* and technology transfer regulations of the United States and of foreign
+* countries. This software is furnished under a license agreement and/or a
+* nondisclosure agreement and may only be used or reproduced in accordance
+* with the terms of those agreements. Dissemination of this information to
+* any party or parties not specified in the license agreement and/or
+* nondisclosure agreement is expressly prohibited.
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL MAXIM INTEGRATED BE LIABLE FOR ANY CLAIM, DAMAGES
+* OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*
+* Except as contained in this notice, the name of Maxim Integrated
+* Products, Inc. shall not be used except as stated in the Maxim Integrated
+* Products, Inc. Branding Policy.
+*
+* The mere transfer of this software does not imply any licenses
+* of trade secrets, proprietary technology, copyrights, patents,
+* trademarks, maskwork rights, or any other form of intellectual
+* property whatsoever. Maxim Integrated Products, Inc. retains all
+* ownership rights.
+*******************************************************************************/
+/*
+*******************************************************************************
+* @file SSD1608_Stream.c
+*
+* @version 1.0
+*
+* Started: 03/02/2021
+*
+* Updated: No current revisions
+*/
+
+#include "SSD1608_Stream.h"
+
+/***** Frame State *****/
+static const uint8_t *stream_bg;				//Background bitmap (NULL = 0x00)
+static uint16_t stream_bg_size;					//Compressed size of stream_bg, 0 if it is a raw rowBytes * height bitmap
+static rle_stream_t stream_rle;					//Decoder for a compressed background
+static uint16_t stream_rle_y;					//Row stream_rle decodes next (past the last row = restart from the top)
+static overlay_t overlays[STREAM_MAX_OVERLAYS];
+static uint8_t overlay_count;
+
+/*
+ * @brief	Sets or clears pixels xs to xe of one row, clipped to the panel width
+ */
+static void clippedSpan(const ssd1608_t *disp, uint8_t *row, int16_t xs, int16_t xe, uint8_t color)
+{
+	if (xs < 0) xs = 0;
+	if (xe >= disp->width) xe = disp->width - 1;
+	if (xs <= xe)
+	{
+		spanRow(row, xs, xe, color);
+	}
+}
+
+/*
+ * @brief	Draws the pixels a line has on row y, matching #WriteLine pixel for pixel.
+ * @note       { #WriteLine steps along the longer axis and changes the other coordinate whenever its error term (starting at
+ * 			dx/2) goes negative. The k-th change happens after floor((dx/2 + k*dx) / dy) steps, so the run on any row can be
+ * 			computed directly without walking the line from its start }
+ */
+static void lineRow(const ssd1608_t *disp, uint8_t *row, int16_t y, const overlay_t *o)
+{
+	int16_t xa = o->x0, ya = o->y0, xb = o->x1, yb = o->y1;
+	int32_t dx, dy, k;
+
+	if (y < ya || y > yb)
+	{
+		return;
+	}
+
+	if (ya == yb)
+	{
+		clippedSpan(disp, row, (xa < xb) ? xa : xb, (xa < xb) ? xb : xa, o->color);
+		return;
+	}
+
+	if ((yb - ya) > abs(xb - xa))
+	{
+		//Steep: one pixel per row, x has moved k times by row y
+		int32_t v;
+		dx = yb - ya;
+		dy = abs(xb - xa);
+		v = (int32_t)(y - ya) * dy - dx / 2;
+		k = (v <= 0) ? 0 : (v + dx - 1) / dx;
+		if (xb < xa) k = -k;
+		clippedSpan(disp, row, xa + k, xa + k, o->color);
+		return;
+	}
+
+	//Shallow: one run per row, stepping along x from the left end
+	if (xa > xb)
+	{
+		int16_t hold;
+		hold = xa; xa = xb; xb = hold;
+		hold = ya; ya = yb; yb = hold;
+	}
+	dx = xb - xa;
+	dy = abs(yb - ya);
+	k = abs(y - ya);
+
+	int32_t start = (k == 0) ? xa : xa + (dx / 2 + (k - 1) * dx) / dy + 1;
+	int32_t end = xa + (dx / 2 + k * dx) / dy;
+	if (end > xb) end = xb;
+	clippedSpan(disp, row, start, end, o->color);
+}
+
+/*
+ * @brief	Renders the part of a circle overlay on one row, from the same midpoint runs as #drawCircle and #fillCircle
+ * @note       { A run (xa..xb, y) puts outline pixels xa..xb on rows y0 +- y and pixels +-y on rows y0 +- xa..xb. A filled
+ * 			circle covers the widest of those on the row }
+ * @param[(in)] <a> { Distance of the row from the center row }
+ */
+static void circleRow(const ssd1608_t *disp, uint8_t *row, int16_t a, const overlay_t *o)
+{
+	circle_walk_t w;
+	int16_t xa, xb, y;
+	int16_t half = -1;
+
+	circleBegin(&w, (uint8_t)o->x1);
+	while (circleNext(&w, &xa, &xb, &y))
+	{
+		if (y < a && xa > a)
+		{
+			break;		//Later runs are further along both axes
+		}
+
+		if (o->type == OVERLAY_FILL_CIRCLE)
+		{
+			if (y == a && xb > half) half = xb;
+			if (xa <= a && a <= xb && y > half) half = y;
+			continue;
+		}
+
+		if (y == a)
+		{
+			clippedSpan(disp, row, o->x0 + xa, o->x0 + xb, o->color);
+			clippedSpan(disp, row, o->x0 - xb, o->x0 - xa, o->color);
+		}
+		if (xa <= a && a <= xb)
+		{
+			clippedSpan(disp, row, o->x0 + y, o->x0 + y, o->color);
+			clippedSpan(disp, row, o->x0 - y, o->x0 - y, o->color);
+		}
+	}
+
+	if (half >= 0)
+	{
+		clippedSpan(disp, row, o->x0 - half, o->x0 + half, o->color);
+	}
+}
+
+/*
+ * @brief	Draws the part of a string that falls on row y
+ */
+static void stringRow(const ssd1608_t *disp, uint8_t *row, int16_t y, const overlay_t *o)
+{
+	const font_t *font = o->font;
+	int16_t x = o->x0;
+	int16_t r = y - o->y0;
+
+	for (const char *c = o->str; *c != '\0' && x < disp->width; c++)
+	{
+		if ((*c >= font->first) && (*c <= font->last))
+		{
+			const glyph_t *g = &font->glyphs[*c - font->first];
+			if (r < g->height)
+			{
+				blitRow(row, disp->rowBytes, x, &g->bitmap[r * g->width], g->width);
+			}
+			x += g->width * 8;
+		}
+		else
+		{
+			if (r < font->height)
+			{
+				blitRow(row, disp->rowBytes, x, NULL, font->blankWidth);
+			}
+			x += font->blankWidth * 8;
+		}
+	}
+}
+
+/*
+ * @brief	Renders row y of the frame: background first, then every overlay in the order it was added
+ * @note       { Called by #displayRows for the rows of the band in order, with ctx pointing at the panel. A compressed background
+ * 			can only be decoded from the top, so the decoder restarts whenever a row comes before the one it is at and skips
+ * 			the rows above the band }
+ */
+static void renderRow(uint16_t y, uint8_t *row, void *ctx)
+{
+	const ssd1608_t *disp = ctx;
+
+	if (stream_bg != NULL && stream_bg_size != 0)
+	{
+		if (y < stream_rle_y)
+		{
+			RLEbegin(&stream_rle, stream_bg, stream_bg_size, disp->rowBytes);
+			stream_rle_y = 0;
+		}
+		for (; stream_rle_y < y; stream_rle_y++)
+		{
+			RLEread(&stream_rle, row, disp->rowBytes);			//Rows above the band, decoded and dropped
+		}
+		stream_rle_y++;
+	}
+
+	if (stream_bg == NULL)
+	{
+		memset(row, 0x00, disp->rowBytes);
+	}
+	else if (stream_bg_size == 0)
+	{
+		memcpy(row, &stream_bg[y * disp->rowBytes], disp->rowBytes);
+	}
+	else
+	{
+		RLEread(&stream_rle, row, disp->rowBytes);
+	}
+
+	for (int i = 0; i < overlay_count; i++)
+	{
+		const overlay_t *o = &overlays[i];
+		int16_t a;
+
+		switch (o->type)
+		{
+		case OVERLAY_STRING:
+			if (y >= o->y0 && y < o->y0 + o->font->height)
+			{
+				stringRow(disp, row, y, o);
+			}
+			break;
+
+		case OVERLAY_GLYPH:
+			if (y >= o->y0 && y < o->y0 + o->glyph->height)
+			{
+				blitRow(row, disp->rowBytes, o->x0, &o->glyph->bitmap[(y - o->y0) * o->glyph->width], o->glyph->width);
+			}
+			break;
+
+		case OVERLAY_RECT:
+			if (y >= o->y0 && y < o->y0 + o->y1)
+			{
+				clippedSpan(disp, row, o->x0, o->x0 + o->x1 - 1, o->color);
+			}
+			break;
+
+		case OVERLAY_LINE:
+			lineRow(disp, row, y, o);
+			break;
+
+		case OVERLAY_CIRCLE:
+		case OVERLAY_FILL_CIRCLE:
+			a = abs(y - o->y0);
+			if (a <= o->x1)
+			{
+				circleRow(disp, row, a, o);
+			}
+			break;
+
+		case OVERLAY_ROWS:
+			if (y >= o->y0 && y < o->y0 + o->y1)
+			{
+				o->render(y, row, o->ctx);
+			}
+			break;
+		}
+	}
+}
+
+/*
+ * @brief	Reserves the next overlay slot
+ * @return     { Pointer to a cleared overlay, NULL when STREAM_MAX_OVERLAYS are in use }
+ */
+static overlay_t *overlayAdd(overlay_type_t type)
+{
+	overlay_t *o;
+
+	if (overlay_count >= STREAM_MAX_OVERLAYS)
+	{
+		return NULL;
+	}
+
+	o = &overlays[overlay_count++];
+	memset(o, 0, sizeof(*o));
+	o->type = type;
+	return o;
+}
+
+/*
+ * @brief	Selects the background of the frame and removes all overlays
+ * @param[(in)] <bitmap> { Full screen bitmap in display order, compressed (e.g. screen_rle) or raw. NULL for a plain 0x00 background }
+ * @param[(in)] <size> { Compressed size in bytes (e.g. SCREEN_RLE_SIZE), or 0 if bitmap is a raw rowBytes * height byte array }
+ */
+void streamBackground(const uint8_t *bitmap, uint16_t size)
+{
+	stream_bg = bitmap;
+	stream_bg_size = size;
+	stream_rle_y = UINT16_MAX;
+	overlay_count = 0;
+}
+
+/*
+ * @brief	Removes all overlays. The background is kept, so a new set of overlays can be added for the next frame
+ */
+void streamClear(void)
+{
+	overlay_count = 0;
+}
+
+/*
+ * @brief	Adds text drawn like #drawString. Each glyph replaces its whole box
+ * @param[(in)] <x> { X position of left edge (fastest when a multiple of 8) }
+ * @param[(in)] <y> { Y position of top edge }
+ * @param[(in)] <font> { Font to draw with }
+ * @param[(in)] <str> { Null terminated string. Not copied, so it must stay valid until #streamDisplay }
+ * @return     { E_NO_ERROR, or E_NONE_AVAIL when the overlay list is full }
+ */
+int streamAddString(int16_t x, int16_t y, const font_t *font, const char *str)
+{
+	overlay_t *o = overlayAdd(OVERLAY_STRING);
+	if (o == NULL)
+	{
+		return E_NONE_AVAIL;
+	}
+
+	o->x0 = x;
+	o->y0 = y;
+	o->font = font;
+	o->str = str;
+	return E_NO_ERROR;
+}
+
+/*
+ * @brief	Adds a single glyph, replacing its whole box
+ * @param[(in)] <x> { X position of left edge }
+ * @param[(in)] <y> { Y position of top edge }
+ * @param[(in)] <glyph> { Glyph to draw }
+ * @return     { E_NO_ERROR, or E_NONE_AVAIL when the overlay list is full }
+ */
+int streamAddGlyph(int16_t x, int16_t y, const glyph_t *glyph)
+{
+	overlay_t *o = overlayAdd(OVERLAY_GLYPH);
+	if (o == NULL)
+	{
+		return E_NONE_AVAIL;
+	}
+
+	o->x0 = x;
+	o->y0 = y;
+	o->glyph = glyph;
+	return E_NO_ERROR;
+}
+
+/*
+ * @brief	Adds a filled rectangle
+ * @param[(in)] <x> { X position of left edge }
+ * @param[(in)] <y> { Y position of top edge }
+ * @param[(in)] <w> { Width in pixels }
+ * @param[(in)] <h> { Height in pixels }
+ * @param[(in)] <color> { 1 sets bits, 0 clears them }
+ * @return     { E_NO_ERROR, or E_NONE_AVAIL when the overlay list is full }
+ */
+int streamAddRect(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t color)
+{
+	overlay_t *o = overlayAdd(OVERLAY_RECT);
+	if (o == NULL)
+	{
+		return E_NONE_AVAIL;
+	}
+
+	o->x0 = x;
+	o->y0 = y;
+	o->x1 = w;
+	o->y1 = h;
+	o->color = color;
+	return E_NO_ERROR;
+}
+
+/*
+ * @brief	Adds a one pixel wide line. Pixels are the same as #WriteLine draws for the same end points
+ * @param[(in)] <x0> { X position of first point }
+ * @param[(in)] <y0> { Y position of first point }
+ * @param[(in)] <x1> { X position of second point }
+ * @param[(in)] <y1> { Y position of second point }
+ * @param[(in)] <color> { 1 sets bits, 0 clears them }
+ * @return     { E_NO_ERROR, or E_NONE_AVAIL when the overlay list is full }
+ */
+int streamAddLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t color)
+{
+	overlay_t *o = overlayAdd(OVERLAY_LINE);
+	if (o == NULL)
+	{
+		return E_NONE_AVAIL;
+	}
+
+	//Rows are rendered top to bottom, so the line is stored that way
+	if (y0 > y1)
+	{
+		int16_t hold;
+		hold = x0; x0 = x1; x1 = hold;
+		hold = y0; y0 = y1; y1 = hold;
+	}
+
+	o->x0 = x0;
+	o->y0 = y0;
+	o->x1 = x1;
+	o->y1 = y1;
+	o->color = color;
+	return E_NO_ERROR;
+}
+
+/*
+ * @brief	Adds a circle
+ * @param[(in)] <x0> { X position of center }
+ * @param[(in)] <y0> { Y position of center }
+ * @param[(in)] <r> { Radius in pixels (0 - 255, as #drawCircle) }
+ * @param[(in)] <color> { 1 sets bits, 0 clears them }
+ * @param[(in)] <fill> { 1 for a filled circle, 0 for the outline only }
+ * @return     { E_NO_ERROR, or E_NONE_AVAIL when the overlay list is full }
+ */
+int streamAddCircle(int16_t x0, int16_t y0, int16_t r, uint8_t color, int fill)
+{
+	overlay_t *o = overlayAdd(fill ? OVERLAY_FILL_CIRCLE : OVERLAY_CIRCLE);
+	if (o == NULL)
+	{
+		return E_NONE_AVAIL;
+	}
+
+	o->x0 = x0;
+	o->y0 = y0;
+	o->x1 = r;
+	o->color = color;
+	return E_NO_ERROR;
+}
+
+/*
+ * @brief	Adds rows drawn by a callback, e.g. a graph that is cheaper to compute row by row than to describe with lines
+ * @note       { render is called for rows y to y+h-1 in order, once per pass (twice per frame with the partial waveform), with
+ * 			the row as the background and earlier overlays left it. It must only change the pixels it owns }
+ * @param[(in)] <y> { First row }
+ * @param[(in)] <h> { Number of rows }
+ * @param[(in)] <render> { Draws into one row (rowBytes bytes) for row y }
+ * @param[(in)] <ctx> { Passed through to render }
+ * @return     { E_NO_ERROR, or E_NONE_AVAIL when the overlay list is full }
+ */
+int streamAddRows(int16_t y, int16_t h, void (*render)(uint16_t y, uint8_t *row, void *ctx), void *ctx)
+{
+	overlay_t *o = overlayAdd(OVERLAY_ROWS);
+	if (o == NULL)
+	{
+		return E_NONE_AVAIL;
+	}
+
+	o->y0 = y;
+	o->y1 = h;
+	o->render = render;
+	o->ctx = ctx;
+	return E_NO_ERROR;
+}
+
+/*
+ * @brief	Renders the frame straight to a panel and refreshes it. The panel's framebuffer is neither read nor written
+ * @note       { The first frame (and every frame with full set) uses the full waveform. Later frames use the partial
+ * 			waveform, see #displayRows. Switching back to #displayScreen afterwards sends the whole framebuffer again }
+ * @param[(in)] <disp> { Panel to send the frame to }
+ * @param[(in)] <full> { 1 forces the full waveform }
+ */
+void streamDisplay(ssd1608_t *disp, int full)
+{
+	displayRows(disp, 0, disp->height - 1, renderRow, disp, full);
+}
+
+/*
+ * @brief	Renders only rows y0 to y1 of the frame to a panel and refreshes it, e.g. the band holding the overlays that changed
+ * @note       { Rows outside the band must look the same as in the last frame sent. The band is only used with the partial
+ * 			waveform: the first frame (and every frame with full set) is sent whole, see #displayRows }
+ * @param[(in)] <disp> { Panel to send the frame to }
+ * @param[(in)] <y0> { First row to send }
+ * @param[(in)] <y1> { Last row to send }
+ * @param[(in)] <full> { 1 forces the full waveform }
+ */
+void streamDisplayRows(ssd1608_t *disp, uint16_t y0, uint16_t y1, int full)
+{
+	displayRows(disp, y0, y1, renderRow, disp, full);
+}
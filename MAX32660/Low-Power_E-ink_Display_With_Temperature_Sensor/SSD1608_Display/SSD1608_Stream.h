@@ -0,0 +1,150 @@
+/*******************************************************************************
+* Copyright (C) Maxim Integrated Products, Inc., All rights Reserved.
+* 
+* This software is protected by copyright laws of the United States and
+* of foreign countries. This material may also be protected by patent laws
+* and technology transfer regulations of the United States and of foreign
+* countries. This software is furnished under a license agreement and/or a
+* nondisclosure agreement and may only be used or reproduced in accordance
+* with the terms of those agreements. Dissemination of this information to
+* any party or parties not specified in the license agreement and/or
+* nondisclosure agreement is expressly prohibited.
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL MAXIM INTEGRATED BE LIABLE FOR ANY CLAIM, DAMAGES
+* OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*
+* Except as contained in this notice, the name of Maxim Integrated
+* Products, Inc. shall not be used except as stated in the Maxim Integrated
+* Products, Inc. Branding Policy.
+*
+* The mere transfer of this software does not imply any licenses
+* of trade secrets, proprietary technology, copyrights, patents,
+* trademarks, maskwork rights, or any other form of intellectual
+* property whatsoever. Maxim Integrated Products, Inc. retains all
+* ownership rights.
+*******************************************************************************/
+/*	NOTE: Streaming render mode for the SSD1608 library. Instead of drawing into a framebuffer, the
+*	application describes a frame as a background bitmap plus a short list of overlays. Each row is
+*	built while the previous rows are being sent to the display, so no framebuffer is needed.
+*******************************************************************************
+* @file SSD1608_Stream.h
+*
+* @version 1.0
+*
+* Started: 03/02/2021
+*
+* Updated: No current revisions
+*/
+
+#ifndef SSD1608_STREAM_H_
+#define SSD1608_STREAM_H_
+
+/***** Includes *****/
+#include <stdint.h>
+#include "SSD1608_Display.h"
+
+/***** Stream Config *****/
+#define STREAM_MAX_OVERLAYS		16		//Overlays one frame can hold
+
+/***** Types *****/
+typedef enum {
+	OVERLAY_STRING,				//Text drawn with a font (opaque glyph boxes, like #drawString)
+	OVERLAY_GLYPH,				//Single glyph
+	OVERLAY_RECT,				//Filled rectangle
+	OVERLAY_LINE,				//One pixel wide line
+	OVERLAY_CIRCLE,				//Circle outline
+	OVERLAY_FILL_CIRCLE,		//Filled circle
+	OVERLAY_ROWS				//Rows filled in by a callback (e.g. a graph)
+} overlay_type_t;
+
+typedef struct {
+	overlay_type_t type;
+	int16_t x0;					//Left edge, line start or circle center
+	int16_t y0;					//Top edge, line start or circle center
+	int16_t x1;					//Width (rect), line end or radius (circles)
+	int16_t y1;					//Height (rect) or line end
+	uint8_t color;				//1 = set bits, 0 = clear bits (rect, line and circles)
+	const glyph_t *glyph;		//OVERLAY_GLYPH
+	const font_t *font;			//OVERLAY_STRING
+	const char *str;			//OVERLAY_STRING, must stay valid until the frame is sent
+	void (*render)(uint16_t y, uint8_t *row, void *ctx);	//OVERLAY_ROWS
+	void *ctx;					//OVERLAY_ROWS, passed through to render
+} overlay_t;
+
+/**
+ * @brief Streaming renderer for the SSD1608 display. A frame is a background plus
+ * up to STREAM_MAX_OVERLAYS overlays, drawn in the order they were added.
+ * #streamDisplay renders each row while earlier rows are on the wire, using only
+ * the two DMA staging buffers of the display driver.
+ *
+ * @code
+ *
+ *	streamBackground(screen_rle, SCREEN_RLE_SIZE);
+ *	streamAddString(8, 80, &digitFont, "98");
+ *	streamAddLine(0, 150, 199, 150, 1);
+ *	streamDisplay(&display, 0);
+ *
+ * @endcode
+ */
+
+/***** Functions *****/
+
+/**
+ * @brief	Selects the background and removes all overlays
+ */
+void streamBackground(const uint8_t *bitmap, uint16_t size);
+
+/**
+ * @brief	Removes all overlays, keeping the background
+ */
+void streamClear(void);
+
+/**
+ * @brief	Adds a string overlay
+ */
+int streamAddString(int16_t x, int16_t y, const font_t *font, const char *str);
+
+/**
+ * @brief	Adds a single glyph overlay
+ */
+int streamAddGlyph(int16_t x, int16_t y, const glyph_t *glyph);
+
+/**
+ * @brief	Adds a filled rectangle overlay
+ */
+int streamAddRect(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t color);
+
+/**
+ * @brief	Adds a line overlay
+ */
+int streamAddLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t color);
+
+/**
+ * @brief	Adds a circle overlay (outline, or filled with fill set)
+ */
+int streamAddCircle(int16_t x0, int16_t y0, int16_t r, uint8_t color, int fill);
+
+/**
+ * @brief	Adds rows that a callback draws into, on top of what is already in them
+ */
+int streamAddRows(int16_t y, int16_t h, void (*render)(uint16_t y, uint8_t *row, void *ctx), void *ctx);
+
+/**
+ * @brief	Renders the frame straight to a panel and refreshes it. The overlay list is shared, so panels are rendered one at a time
+ */
+void streamDisplay(ssd1608_t *disp, int full);
+
+/**
+ * @brief	Renders rows y0 to y1 of the frame to a panel whose other rows have not changed since the last frame
+ */
+void streamDisplayRows(ssd1608_t *disp, uint16_t y0, uint16_t y1, int full);
+
+#endif /* SSD1608_STREAM_H_ */
@@ -0,0 +1,106 @@
+/*******************************************************************************
+* Copyright (C) Maxim Integrated Products, Inc., All rights Reserved.
+* 
+* This software is protected by copyright laws of the United States and
+* of foreign countries. This material may also be protected by patent laws
+* and technology transfer regulations of the United States and of foreign
+* countries. This software is furnished under a license agreement and/or a
+* nondisclosure agreement and may only be used or reproduced in accordance
+* with the terms of those agreements. Dissemination of this information to
+* any party or parties not specified in the license agreement and/or
+* nondisclosure agreement is expressly prohibited.
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL MAXIM INTEGRATED BE LIABLE FOR ANY CLAIM, DAMAGES
+* OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*
+* Except as contained in this notice, the name of Maxim Integrated
+* Products, Inc. shall not be used except as stated in the Maxim Integrated
+* Products, Inc. Branding Policy.
+*
+* The mere transfer of this software does not imply any licenses
+* of trade secrets, proprietary technology, copyrights, patents,
+* trademarks, maskwork rights, or any other form of intellectual
+* property whatsoever. Maxim Integrated Products, Inc. retains all
+* ownership rights.
+*******************************************************************************/
+/*
+*******************************************************************************
+* @file Adaptive_Sampler.c
+*
+* @version 1.0
+*
+* Started: 03/02/2021
+*
+* Updated: No current revisions
+*/
+
+#include <stdlib.h>
+#include "Adaptive_Sampler.h"
+
+/*
+ * @brief	Restarts the sampler: the next reading becomes the reference and the period starts at the minimum
+ * @param[(in)] <s> { Sampler, minPeriod, maxPeriod, band and slope filled in }
+ */
+void Sampler_Reset(sampler_t *s)
+{
+	s->period = 0;
+}
+
+/*
+ * @brief	Adds a reading and works out when the next one should be taken
+ * @note       { Readings within s->band of the reference double the period, up to the maximum. A reading outside the band
+ * 			becomes the new reference, and the period depends on how fast the temperature got there (change since the
+ * 			reference, scaled to one minute): faster than s->slope goes back to the minimum period, slower halves it.
+ * 			Sensor noise inside the band is never treated as a slope, and comparing against a fixed reference instead of
+ * 			the previous reading keeps a slow drift from hiding in the band }
+ * @param[(in)] <s> { Sampler }
+ * @param[(in)] <nowMs> { Time of the reading (ms, e.g. #Sched_Now) }
+ * @param[(in)] <centi> { Reading in hundredths of a degree }
+ * @return     { Milliseconds until the next reading }
+ */
+uint32_t Sampler_Update(sampler_t *s, uint32_t nowMs, int16_t centi)
+{
+	if (s->period == 0)
+	{
+		s->period = s->minPeriod;
+	}
+	else
+	{
+		uint32_t drift = abs(centi - s->ref);
+
+		if (drift <= (uint32_t)s->band)
+		{
+			s->period *= 2;
+			if (s->period > s->maxPeriod)
+			{
+				s->period = s->maxPeriod;
+			}
+			return s->period;
+		}
+
+		if ((uint64_t)drift * 60000 > (uint64_t)s->slope * (nowMs - s->refMs))		//drift / time > slope / 1 minute
+		{
+			s->period = s->minPeriod;
+		}
+		else
+		{
+			s->period /= 2;
+			if (s->period < s->minPeriod)
+			{
+				s->period = s->minPeriod;
+			}
+		}
+	}
+
+	s->ref = centi;
+	s->refMs = nowMs;
+	return s->period;
+}
@@ -0,0 +1,90 @@
+/*******************************************************************************
+* Copyright (C) Maxim Integrated Products, Inc., All rights Reserved.
+* 
+* This software is protected by copyright laws of the United States and
+* of foreign countries. This material may also be protected by patent laws
+* and technology transfer regulations of the United States and of foreign
+* countries. This software is furnished under a license agreement and/or a
+* nondisclosure agreement and may only be used or reproduced in accordance
+* with the terms of those agreements. Dissemination of this information to
+* any party or parties not specified in the license agreement and/or
+* nondisclosure agreement is expressly prohibited.
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL MAXIM INTEGRATED BE LIABLE FOR ANY CLAIM, DAMAGES
+* OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*
+* Except as contained in this notice, the name of Maxim Integrated
+* Products, Inc. shall not be used except as stated in the Maxim Integrated
+* Products, Inc. Branding Policy.
+*
+* The mere transfer of this software does not imply any licenses
+* of trade secrets, proprietary technology, copyrights, patents,
+* trademarks, maskwork rights, or any other form of intellectual
+* property whatsoever. Maxim Integrated Products, Inc. retains all
+* ownership rights.
+*******************************************************************************/
+/*	NOTE: Adaptive sampling period for the "Wearable Temperature Sensor LP" project. While readings stay
+*	inside a band the time between readings is doubled, up to a maximum. When the temperature leaves the
+*	band faster than a threshold slope the period drops straight back to the minimum, so a fever onset is
+*	still followed closely. All temperatures are integer hundredths of a degree.
+*******************************************************************************
+* @file Adaptive_Sampler.h
+*
+* @version 1.0
+*
+* Started: 03/02/2021
+*
+* Updated: No current revisions
+*/
+
+#ifndef ADAPTIVE_SAMPLER_H_
+#define ADAPTIVE_SAMPLER_H_
+
+/***** Includes *****/
+#include <stdint.h>
+
+/***** Types *****/
+typedef struct {
+	uint32_t minPeriod;			//Shortest time between readings (ms)
+	uint32_t maxPeriod;			//Longest time between readings (ms)
+	int16_t band;				//Readings within +-band of the reference count as steady (centi-degrees)
+	int16_t slope;				//Change per minute that counts as fast (centi-degrees)
+	uint32_t period;			//Current time between readings (ms), 0 before the first reading
+	int16_t ref;				//Reading the band is centered on
+	uint32_t refMs;				//Time of that reading
+} sampler_t;
+
+/**
+ * @brief Picks the time until the next temperature reading from the readings so far.
+ *
+ * @code
+ *
+ * static sampler_t sampler = { .minPeriod = 7000, .maxPeriod = 56000, .band = 10, .slope = 10 };
+ *
+ * uint32_t next = Sampler_Update(&sampler, Sched_Now(), centiF);
+ * Sched_RunIn(&task_sense, next);
+ *
+ * @endcode
+ */
+
+/***** Functions *****/
+
+/**
+ * @brief	Restarts the sampler at the minimum period, e.g. after the sensor was replaced
+ */
+void Sampler_Reset(sampler_t *s);
+
+/**
+ * @brief	Adds a reading and returns the time until the next one (ms)
+ */
+uint32_t Sampler_Update(sampler_t *s, uint32_t nowMs, int16_t centi);
+
+#endif /* ADAPTIVE_SAMPLER_H_ */
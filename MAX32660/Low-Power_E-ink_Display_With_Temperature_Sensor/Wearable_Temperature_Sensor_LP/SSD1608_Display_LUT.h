@@ -39,6 +39,16 @@
 *   NOTE: For more inforamtion on how to create pre-designed screen, view
 *   the "modification" section on:
 *   https://www.hackster.io/thomas-lyp/human-body-temperature-to-e-ink-display-part-1-8d2500
+*
+*   All arrays are stored in display order (most significant bit = leftmost
+*   pixel), so they can be sent or copied into a framebuffer without conversion.
+*   GIMP exports XBM bitmaps least significant bit first; run new exports
+*   through tools/xbm2lut.py before adding them here.
+*
+*   The full-screen backgrounds (logo_rle, screen_rle) are compressed: each
+*   row XORed with the row above, then PackBits. Expand them with RLEdecode
+*   or stream them to the display with BitMapTransferRLE. Generate them with
+*   "tools/xbm2lut.py --rle" or convert a raw array with tools/lut2rle.py.
 */
 
 /******************************************************************************
@@ -57,967 +67,393 @@
 #ifndef SSD1608_DISPLAY_LUT_H_
 #define SSD1608_DISPLAY_LUT_H_
 
+/* Arrays below are definitions, kept in flash as const. Include this file from one .c file only */
+
 
-uint8_t ZERO[] = {
+const uint8_t ZERO[] = {
    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x40, 0x03, 0x00, 0xf0, 0x0f, 0x00, 0xf8, 0x1f, 0x00, 0x1c, 0x1c,
-   0x00, 0x0e, 0x3c, 0x00, 0x0e, 0x38, 0x00, 0x07, 0x38, 0x80, 0x03, 0x38,
-   0x80, 0x03, 0x38, 0x80, 0x03, 0x38, 0x80, 0x03, 0x1c, 0xc0, 0x01, 0x1c,
-   0xc0, 0x01, 0x1c, 0xc0, 0x01, 0x1c, 0xc0, 0x01, 0x0e, 0xc0, 0x01, 0x0e,
-   0xc0, 0x01, 0x07, 0xc0, 0x01, 0x07, 0xc0, 0xc3, 0x03, 0x80, 0xff, 0x01,
-   0x00, 0x7f, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x02, 0xc0, 0x00, 0x0f, 0xf0, 0x00, 0x1f, 0xf8, 0x00, 0x38, 0x38,
+   0x00, 0x70, 0x3c, 0x00, 0x70, 0x1c, 0x00, 0xe0, 0x1c, 0x01, 0xc0, 0x1c,
+   0x01, 0xc0, 0x1c, 0x01, 0xc0, 0x1c, 0x01, 0xc0, 0x38, 0x03, 0x80, 0x38,
+   0x03, 0x80, 0x38, 0x03, 0x80, 0x38, 0x03, 0x80, 0x70, 0x03, 0x80, 0x70,
+   0x03, 0x80, 0xe0, 0x03, 0x80, 0xe0, 0x03, 0xc3, 0xc0, 0x01, 0xff, 0x80,
+   0x00, 0xfe, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 
-uint8_t ONE[] = {
+const uint8_t ONE[] = {
    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x02, 0x00, 0xc0, 0x01, 0x00, 0xf8, 0x01, 0x00, 0xfe, 0x01,
-   0x00, 0xcf, 0x01, 0x00, 0xc2, 0x01, 0x00, 0xe0, 0x00, 0x00, 0xe0, 0x00,
-   0x00, 0xe0, 0x00, 0x00, 0xe0, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x70, 0x00,
-   0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x30, 0x00,
-   0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0xe0, 0xff, 0x07,
-   0xe0, 0xff, 0x07, 0xe0, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x40, 0x00, 0x03, 0x80, 0x00, 0x1f, 0x80, 0x00, 0x7f, 0x80,
+   0x00, 0xf3, 0x80, 0x00, 0x43, 0x80, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00,
+   0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0e, 0x00,
+   0x00, 0x0e, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x0c, 0x00,
+   0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x07, 0xff, 0xe0,
+   0x07, 0xff, 0xe0, 0x07, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 
-uint8_t TWO[]={
+const uint8_t TWO[] = {
    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0xc0, 0x05, 0x00, 0xf8, 0x0f, 0x00, 0xfc, 0x1f, 0x00, 0x1e, 0x3c,
-   0x00, 0x07, 0x38, 0x00, 0x07, 0x38, 0x80, 0x03, 0x38, 0x00, 0x01, 0x3c,
-   0x00, 0x00, 0x1c, 0x00, 0x00, 0x1f, 0x00, 0x80, 0x0f, 0x00, 0xc0, 0x03,
-   0x00, 0xe0, 0x01, 0x00, 0xf8, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x1e, 0x00,
-   0x80, 0x0f, 0x00, 0xc0, 0x07, 0x00, 0xe0, 0x01, 0x04, 0xf0, 0xff, 0x07,
-   0xf8, 0xff, 0x07, 0xf8, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x03, 0xa0, 0x00, 0x1f, 0xf0, 0x00, 0x3f, 0xf8, 0x00, 0x78, 0x3c,
+   0x00, 0xe0, 0x1c, 0x00, 0xe0, 0x1c, 0x01, 0xc0, 0x1c, 0x00, 0x80, 0x3c,
+   0x00, 0x00, 0x38, 0x00, 0x00, 0xf8, 0x00, 0x01, 0xf0, 0x00, 0x03, 0xc0,
+   0x00, 0x07, 0x80, 0x00, 0x1f, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x78, 0x00,
+   0x01, 0xf0, 0x00, 0x03, 0xe0, 0x00, 0x07, 0x80, 0x20, 0x0f, 0xff, 0xe0,
+   0x1f, 0xff, 0xe0, 0x1f, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 
-uint8_t THREE[]={
+const uint8_t THREE[] = {
    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0xc0, 0x03, 0x00, 0xf8, 0x1f, 0x00, 0xfc, 0x1f, 0x00, 0x1e, 0x3c,
-   0x00, 0x06, 0x38, 0x00, 0x02, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1c,
-   0x00, 0x00, 0x1e, 0x00, 0xe0, 0x0f, 0x00, 0xf0, 0x07, 0x00, 0xf0, 0x0f,
-   0x00, 0x00, 0x0f, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c,
-   0x00, 0x00, 0x0e, 0x00, 0x00, 0x0e, 0x20, 0x80, 0x07, 0xf0, 0xff, 0x03,
-   0xe0, 0xff, 0x01, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x03, 0xc0, 0x00, 0x1f, 0xf8, 0x00, 0x3f, 0xf8, 0x00, 0x78, 0x3c,
+   0x00, 0x60, 0x1c, 0x00, 0x40, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x38,
+   0x00, 0x00, 0x78, 0x00, 0x07, 0xf0, 0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xf0,
+   0x00, 0x00, 0xf0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38,
+   0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x04, 0x01, 0xe0, 0x0f, 0xff, 0xc0,
+   0x07, 0xff, 0x80, 0x00, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 
-uint8_t FOUR[]={
+const uint8_t FOUR[] = {
    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x1e, 0x00, 0x00, 0x1f, 0x00, 0x80, 0x0f, 0x00, 0xc0, 0x0f,
-   0x00, 0xc0, 0x0f, 0x00, 0xe0, 0x0e, 0x00, 0x70, 0x0f, 0x00, 0x78, 0x06,
-   0x00, 0x3c, 0x07, 0x00, 0x1c, 0x07, 0x00, 0x0e, 0x07, 0x00, 0x07, 0x07,
-   0x80, 0x87, 0x03, 0xc0, 0x83, 0x03, 0xc0, 0xff, 0x0f, 0xe0, 0xff, 0x0f,
-   0xe0, 0xff, 0x07, 0x00, 0xc0, 0x01, 0x00, 0xc0, 0x01, 0x00, 0xf8, 0x07,
-   0x00, 0xfc, 0x03, 0x00, 0xfc, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x78, 0x00, 0x00, 0xf8, 0x00, 0x01, 0xf0, 0x00, 0x03, 0xf0,
+   0x00, 0x03, 0xf0, 0x00, 0x07, 0x70, 0x00, 0x0e, 0xf0, 0x00, 0x1e, 0x60,
+   0x00, 0x3c, 0xe0, 0x00, 0x38, 0xe0, 0x00, 0x70, 0xe0, 0x00, 0xe0, 0xe0,
+   0x01, 0xe1, 0xc0, 0x03, 0xc1, 0xc0, 0x03, 0xff, 0xf0, 0x07, 0xff, 0xf0,
+   0x07, 0xff, 0xe0, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x1f, 0xe0,
+   0x00, 0x3f, 0xc0, 0x00, 0x3f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 
-uint8_t FIVE[]={
+const uint8_t FIVE[] = {
    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0xfc, 0x3f, 0x00, 0xfc, 0x3f, 0x00, 0xfe, 0x1f, 0x00, 0x0e, 0x00,
-   0x00, 0x0e, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x0e, 0x00, 0x00, 0xce, 0x01,
-   0x00, 0xff, 0x07, 0x00, 0xff, 0x0f, 0x00, 0x07, 0x1e, 0x00, 0x02, 0x1c,
-   0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c,
-   0x00, 0x00, 0x0e, 0x40, 0x00, 0x0e, 0xf0, 0x80, 0x07, 0xf0, 0xff, 0x03,
-   0xe0, 0xff, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x7f, 0xf8, 0x00, 0x70, 0x00,
+   0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x73, 0x80,
+   0x00, 0xff, 0xe0, 0x00, 0xff, 0xf0, 0x00, 0xe0, 0x78, 0x00, 0x40, 0x38,
+   0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38,
+   0x00, 0x00, 0x70, 0x02, 0x00, 0x70, 0x0f, 0x01, 0xe0, 0x0f, 0xff, 0xc0,
+   0x07, 0xff, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 
-uint8_t SIX[]={
+const uint8_t SIX[] = {
    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x34, 0x00, 0x80, 0xff, 0x00, 0xc0, 0xff, 0x00, 0xf0, 0x41,
-   0x00, 0x78, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x1e, 0x00,
-   0x00, 0x0f, 0x00, 0x00, 0x87, 0x03, 0x80, 0xf7, 0x0f, 0x80, 0xf7, 0x0f,
-   0x80, 0x1f, 0x1e, 0x80, 0x0f, 0x1c, 0x80, 0x07, 0x1c, 0x80, 0x03, 0x1c,
-   0x80, 0x03, 0x1c, 0x80, 0x03, 0x0e, 0x80, 0x07, 0x0f, 0x00, 0xff, 0x07,
-   0x00, 0xff, 0x01, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x00, 0x2c, 0x00, 0x01, 0xff, 0x00, 0x03, 0xff, 0x00, 0x0f, 0x82,
+   0x00, 0x1e, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x38, 0x00, 0x00, 0x78, 0x00,
+   0x00, 0xf0, 0x00, 0x00, 0xe1, 0xc0, 0x01, 0xef, 0xf0, 0x01, 0xef, 0xf0,
+   0x01, 0xf8, 0x78, 0x01, 0xf0, 0x38, 0x01, 0xe0, 0x38, 0x01, 0xc0, 0x38,
+   0x01, 0xc0, 0x38, 0x01, 0xc0, 0x70, 0x01, 0xe0, 0xf0, 0x00, 0xff, 0xe0,
+   0x00, 0xff, 0x80, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 
-uint8_t SEVEN[]={
+const uint8_t SEVEN[] = {
    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0xfe, 0x7f, 0x00, 0xff, 0x7f, 0x00, 0xff, 0x7f, 0x00, 0x07, 0x38,
-   0x00, 0x01, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x0e,
-   0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x80, 0x03, 0x00, 0x80, 0x03,
-   0x00, 0xc0, 0x01, 0x00, 0xc0, 0x01, 0x00, 0xe0, 0x00, 0x00, 0xe0, 0x00,
-   0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00,
-   0x00, 0x1c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x7f, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0xe0, 0x1c,
+   0x00, 0x80, 0x1c, 0x00, 0x00, 0x38, 0x00, 0x00, 0x78, 0x00, 0x00, 0x70,
+   0x00, 0x00, 0xe0, 0x00, 0x00, 0xe0, 0x00, 0x01, 0xc0, 0x00, 0x01, 0xc0,
+   0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00,
+   0x00, 0x0e, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00,
+   0x00, 0x38, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 
-uint8_t EIGHT[]={
+const uint8_t EIGHT[] = {
    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x40, 0x03, 0x00, 0xf0, 0x0f, 0x00, 0xfc, 0x1f, 0x00, 0x1e, 0x3c,
-   0x00, 0x06, 0x38, 0x00, 0x07, 0x38, 0x00, 0x07, 0x38, 0x00, 0x07, 0x1c,
-   0x00, 0x0f, 0x1e, 0x00, 0xfe, 0x07, 0x00, 0xfe, 0x07, 0x00, 0xff, 0x07,
-   0x80, 0x07, 0x0f, 0xc0, 0x03, 0x0e, 0xc0, 0x01, 0x0e, 0xc0, 0x00, 0x0e,
-   0xe0, 0x00, 0x0e, 0xe0, 0x01, 0x07, 0xc0, 0x81, 0x07, 0xc0, 0xff, 0x03,
-   0x80, 0xff, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x02, 0xc0, 0x00, 0x0f, 0xf0, 0x00, 0x3f, 0xf8, 0x00, 0x78, 0x3c,
+   0x00, 0x60, 0x1c, 0x00, 0xe0, 0x1c, 0x00, 0xe0, 0x1c, 0x00, 0xe0, 0x38,
+   0x00, 0xf0, 0x78, 0x00, 0x7f, 0xe0, 0x00, 0x7f, 0xe0, 0x00, 0xff, 0xe0,
+   0x01, 0xe0, 0xf0, 0x03, 0xc0, 0x70, 0x03, 0x80, 0x70, 0x03, 0x00, 0x70,
+   0x07, 0x00, 0x70, 0x07, 0x80, 0xe0, 0x03, 0x81, 0xe0, 0x03, 0xff, 0xc0,
+   0x01, 0xff, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 
-uint8_t NINE[]={
+const uint8_t NINE[] = {
    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x80, 0x03, 0x00, 0xf0, 0x0f, 0x00, 0xf8, 0x1f, 0x00, 0x1c, 0x3c,
-   0x00, 0x0e, 0x38, 0x00, 0x0e, 0x38, 0x00, 0x07, 0x38, 0x00, 0x07, 0x38,
-   0x00, 0x07, 0x3c, 0x00, 0x07, 0x3c, 0x00, 0x0f, 0x3f, 0x00, 0xfe, 0x3d,
-   0x00, 0xfc, 0x3d, 0x00, 0x30, 0x1c, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x0f,
-   0x00, 0x80, 0x07, 0x00, 0xc0, 0x07, 0x40, 0xf0, 0x01, 0xc0, 0xff, 0x00,
-   0xe0, 0x3f, 0x00, 0x40, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+   0x00, 0x01, 0xc0, 0x00, 0x0f, 0xf0, 0x00, 0x1f, 0xf8, 0x00, 0x38, 0x3c,
+   0x00, 0x70, 0x1c, 0x00, 0x70, 0x1c, 0x00, 0xe0, 0x1c, 0x00, 0xe0, 0x1c,
+   0x00, 0xe0, 0x3c, 0x00, 0xe0, 0x3c, 0x00, 0xf0, 0xfc, 0x00, 0x7f, 0xbc,
+   0x00, 0x3f, 0xbc, 0x00, 0x0c, 0x38, 0x00, 0x00, 0x78, 0x00, 0x00, 0xf0,
+   0x00, 0x01, 0xe0, 0x00, 0x03, 0xe0, 0x02, 0x0f, 0x80, 0x03, 0xff, 0x00,
+   0x07, 0xfc, 0x00, 0x02, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 
 
-uint8_t logo [5000] = {
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0xff, 0x5f, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xbf, 0x00, 0x00, 0x00, 0xf8,
-   0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xff, 0x1f, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0x1f, 0x24, 0x49, 0x92,
-   0xe2, 0xff, 0xff, 0xff, 0x07, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0x1f,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xff, 0x0f, 0x00, 0x00,
-   0x00, 0xc0, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xff,
-   0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xff, 0x07, 0x00,
-   0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0xe0, 0xff,
-   0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0x03,
-   0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xc0,
-   0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff,
-   0x03, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-   0xc0, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff,
-   0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0x7f, 0x00, 0x00, 0x00,
-   0x00, 0x80, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-   0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0x7f, 0x00, 0x00,
-   0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0x3f, 0x00,
-   0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x80, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0x1f,
-   0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
-   0x00, 0x80, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff,
-   0x1f, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00,
-   0x00, 0x00, 0xc0, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0xf0,
-   0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0x03, 0x00,
-   0x00, 0x00, 0x00, 0xc0, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00,
-   0xf0, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0x03,
-   0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
-   0x00, 0xe0, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
-   0x03, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00,
-   0x00, 0x00, 0xe0, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff,
-   0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff, 0x03, 0x00,
-   0xb4, 0x0d, 0x00, 0xc0, 0xff, 0x03, 0x00, 0xb0, 0x2d, 0x00, 0xc0, 0xff,
-   0xff, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff, 0x01,
-   0x00, 0xfc, 0x1f, 0x00, 0xc0, 0xff, 0x03, 0x00, 0xf0, 0x3f, 0x00, 0x80,
-   0xff, 0xff, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff,
-   0x01, 0x00, 0xfc, 0x1f, 0x00, 0x80, 0xff, 0x01, 0x00, 0xf8, 0x3f, 0x00,
-   0x80, 0xff, 0xff, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0xff,
-   0xff, 0x01, 0x00, 0xfc, 0x3f, 0x00, 0x80, 0xff, 0x01, 0x00, 0xfc, 0x3f,
-   0x00, 0x80, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff,
-   0xff, 0xff, 0x01, 0x00, 0xfc, 0x3f, 0x00, 0x80, 0xff, 0x00, 0x00, 0xfc,
-   0x3f, 0x00, 0x80, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0xf0,
-   0xff, 0xff, 0xff, 0x01, 0x00, 0xfc, 0x7f, 0x00, 0x80, 0x7f, 0x00, 0x00,
-   0xfe, 0x3f, 0x00, 0x80, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00,
-   0xf0, 0xff, 0xff, 0xff, 0x01, 0x00, 0xfc, 0xff, 0x00, 0xc0, 0x7f, 0x00,
-   0x00, 0xff, 0x3f, 0x00, 0xc0, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00,
-   0x00, 0xf8, 0xff, 0xff, 0xff, 0x01, 0x00, 0xfc, 0xff, 0x00, 0xe0, 0x3f,
-   0x00, 0x00, 0xff, 0x3f, 0x00, 0x80, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00,
-   0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0x01, 0x00, 0xfc, 0xff, 0x01, 0xe0,
-   0x3f, 0x00, 0x00, 0xff, 0x3f, 0x00, 0x80, 0xff, 0xff, 0xff, 0x1f, 0x00,
-   0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0x01, 0x00, 0xf8, 0xff, 0x01,
-   0xe0, 0x1f, 0x00, 0x80, 0xff, 0x3f, 0x00, 0x80, 0xff, 0xff, 0xff, 0x1f,
-   0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0x01, 0x00, 0xfc, 0xff,
-   0x03, 0xf0, 0x0f, 0x00, 0xc0, 0xff, 0x3f, 0x00, 0x80, 0xff, 0xff, 0xff,
-   0x1f, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0x01, 0x00, 0xfc,
-   0xff, 0x03, 0xf8, 0x0f, 0x00, 0xc0, 0xff, 0x3f, 0x00, 0x80, 0xff, 0xff,
-   0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xff, 0xff, 0x01, 0x00,
-   0xfc, 0xff, 0x07, 0xf8, 0x0f, 0x00, 0xe0, 0xff, 0x3f, 0x00, 0xc0, 0xff,
-   0xff, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xff, 0xff, 0x01,
-   0x00, 0xfc, 0xff, 0x0f, 0xfc, 0x07, 0x00, 0xe0, 0xff, 0x3f, 0x00, 0x80,
-   0xff, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xff, 0xff,
-   0x01, 0x00, 0xfc, 0xff, 0x0f, 0xfc, 0x03, 0x00, 0xf0, 0xff, 0x3f, 0x00,
-   0x80, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xff,
-   0xff, 0x01, 0x00, 0xfc, 0xff, 0x1f, 0xfe, 0x03, 0x00, 0xf0, 0xff, 0x3f,
-   0x00, 0x80, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff,
-   0xff, 0xff, 0x01, 0x00, 0xfc, 0xff, 0x1f, 0xff, 0x01, 0x00, 0xf8, 0xff,
-   0x3f, 0x00, 0x80, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0xfc,
-   0xff, 0xff, 0xff, 0x01, 0x00, 0xfc, 0xff, 0x3f, 0xff, 0x01, 0x00, 0xfc,
-   0xff, 0x3f, 0x00, 0x80, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00,
-   0xfc, 0xff, 0xff, 0xff, 0x01, 0x00, 0xfc, 0xff, 0x3f, 0xff, 0x00, 0x00,
-   0xfc, 0xff, 0x3f, 0x00, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x00,
-   0x00, 0xfc, 0xff, 0xff, 0xff, 0x01, 0x00, 0xfc, 0xff, 0xff, 0xff, 0x00,
-   0x00, 0xfc, 0xff, 0x3f, 0x00, 0x80, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x00,
-   0x00, 0x00, 0xfc, 0xff, 0xff, 0xff, 0x01, 0x00, 0xfc, 0xff, 0xff, 0x7f,
-   0x00, 0x00, 0xfe, 0xff, 0x3f, 0x00, 0x80, 0xff, 0xff, 0xff, 0x3f, 0x00,
-   0x00, 0x00, 0x00, 0xfc, 0xff, 0xff, 0xff, 0x01, 0x00, 0xfc, 0xff, 0xff,
-   0x3f, 0x00, 0x00, 0xff, 0xff, 0x3f, 0x00, 0x80, 0xff, 0xff, 0xff, 0x3f,
-   0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xff, 0x01, 0x00, 0xfc, 0xff,
-   0xff, 0x3f, 0x00, 0x00, 0xff, 0xff, 0x1f, 0x00, 0xc0, 0xff, 0xff, 0xff,
-   0x3f, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xff, 0xff, 0x01, 0x00, 0xfc,
-   0xff, 0xff, 0x1f, 0x00, 0x80, 0xff, 0xff, 0x3f, 0x00, 0x80, 0xff, 0xff,
-   0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xff, 0x01, 0x00,
-   0xfc, 0xff, 0xff, 0x1f, 0x00, 0x80, 0xff, 0xff, 0x3f, 0x00, 0x80, 0xff,
-   0xff, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xff, 0xff, 0x01,
-   0x00, 0xfc, 0xff, 0xff, 0x0f, 0x00, 0xc0, 0xff, 0xff, 0x3f, 0x00, 0x80,
-   0xff, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xff,
-   0x01, 0x00, 0xfc, 0xff, 0xff, 0x0f, 0x00, 0xe0, 0xff, 0xff, 0x3f, 0x00,
-   0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xff,
-   0xff, 0x01, 0x00, 0xfc, 0xff, 0xff, 0x07, 0x00, 0xe0, 0xff, 0xff, 0x3f,
-   0x00, 0x80, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff,
-   0xff, 0xff, 0x01, 0x00, 0xfc, 0xff, 0xff, 0x03, 0x00, 0xc0, 0xff, 0xff,
-   0x3f, 0x00, 0x80, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0xfc,
-   0xff, 0xff, 0xff, 0x01, 0x00, 0xfc, 0xff, 0xff, 0x03, 0x00, 0xc0, 0xff,
-   0xff, 0x3f, 0x00, 0x80, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00,
-   0xfc, 0xff, 0xff, 0xff, 0x01, 0x00, 0xfc, 0xff, 0xff, 0x03, 0x00, 0x80,
-   0xff, 0xff, 0x3f, 0x00, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x00,
-   0x00, 0xfc, 0xff, 0xff, 0xff, 0x01, 0x00, 0xf8, 0xff, 0xff, 0x01, 0x00,
-   0x80, 0xff, 0xff, 0x3f, 0x00, 0x80, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x00,
-   0x00, 0x00, 0xfc, 0xff, 0xff, 0xff, 0x01, 0x00, 0xfc, 0xff, 0xff, 0x00,
-   0x00, 0x00, 0xff, 0xff, 0x3f, 0x00, 0x80, 0xff, 0xff, 0xff, 0x3f, 0x00,
-   0x00, 0x00, 0x00, 0xfc, 0xff, 0xff, 0xff, 0x01, 0x00, 0xfc, 0xff, 0xff,
-   0x00, 0x00, 0x00, 0xff, 0xff, 0x3f, 0x00, 0x80, 0xff, 0xff, 0xff, 0x3f,
-   0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xff, 0xff, 0x01, 0x00, 0xfc, 0xff,
-   0x7f, 0x00, 0x00, 0x00, 0xfe, 0xff, 0x3f, 0x00, 0xc0, 0xff, 0xff, 0xff,
-   0x1f, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0x01, 0x00, 0xfc,
-   0xff, 0x7f, 0x00, 0x00, 0x00, 0xfc, 0xff, 0x3f, 0x00, 0x80, 0xff, 0xff,
-   0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xff, 0xff, 0x01, 0x00,
-   0xfc, 0xff, 0x3f, 0x00, 0x00, 0x00, 0xfe, 0xff, 0x1f, 0x00, 0x80, 0xff,
-   0xff, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0x01,
-   0x00, 0xfc, 0xff, 0x3f, 0x00, 0x00, 0x00, 0xf8, 0xff, 0x3f, 0x00, 0x80,
-   0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff,
-   0x01, 0x00, 0xfc, 0xff, 0x1f, 0x00, 0x00, 0x00, 0xf8, 0xff, 0x3f, 0x00,
-   0xc0, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff,
-   0xff, 0x01, 0x00, 0xf8, 0xff, 0x0f, 0x00, 0x00, 0x00, 0xf0, 0xff, 0x3f,
-   0x00, 0x80, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff,
-   0xff, 0xff, 0x01, 0x00, 0xfc, 0xff, 0x0f, 0x00, 0x00, 0x00, 0xf0, 0xff,
-   0x3f, 0x00, 0x80, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0xf0,
-   0xff, 0xff, 0xff, 0x01, 0x00, 0xfc, 0xff, 0x07, 0x00, 0x00, 0x00, 0xe0,
-   0xff, 0x3f, 0x00, 0x80, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00,
-   0xf8, 0xff, 0xff, 0xff, 0x01, 0x00, 0xfc, 0xff, 0x07, 0x00, 0x00, 0x00,
-   0xe0, 0xff, 0x3f, 0x00, 0xc0, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00,
-   0x00, 0xf0, 0xff, 0xff, 0xff, 0x01, 0x00, 0xfc, 0xff, 0x03, 0x00, 0x00,
-   0x00, 0xc0, 0xff, 0x3f, 0x00, 0x80, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00,
-   0x00, 0x00, 0xf0, 0xff, 0xff, 0xff, 0x01, 0x00, 0xfc, 0xff, 0x03, 0x00,
-   0x10, 0x00, 0xc0, 0xff, 0x3f, 0x00, 0x80, 0xff, 0xff, 0xff, 0x0f, 0x00,
-   0x00, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff, 0x01, 0x00, 0xfc, 0xff, 0x01,
-   0x00, 0x18, 0x00, 0x80, 0xff, 0x3f, 0x00, 0x80, 0xff, 0xff, 0xff, 0x07,
-   0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xff, 0x01, 0x00, 0xfc, 0xff,
-   0x00, 0x00, 0x18, 0x00, 0x00, 0xff, 0x3f, 0x00, 0xc0, 0xff, 0xff, 0xff,
-   0x07, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff, 0x01, 0x00, 0xfc,
-   0xff, 0x00, 0x00, 0x3c, 0x00, 0x00, 0xff, 0x3f, 0x00, 0x80, 0xff, 0xff,
-   0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff, 0x01, 0x00,
-   0xfc, 0x7f, 0x00, 0x00, 0x7e, 0x00, 0x00, 0xfe, 0x1f, 0x00, 0x80, 0xff,
-   0xff, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0xff, 0xff, 0x01,
-   0x00, 0xfc, 0x7f, 0x00, 0x00, 0x7e, 0x00, 0x00, 0xfe, 0x3f, 0x00, 0x80,
-   0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0xff, 0xff,
-   0x01, 0x00, 0xfc, 0x3f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x3f, 0x00,
-   0xc0, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0xff,
-   0xff, 0x01, 0x00, 0xfc, 0x3f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x3f,
-   0x00, 0x80, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff,
-   0xff, 0xff, 0x01, 0x00, 0xfc, 0x1f, 0x00, 0x80, 0xff, 0x01, 0x00, 0xf8,
-   0x3f, 0x00, 0xc0, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80,
-   0xff, 0xff, 0xff, 0x01, 0x00, 0xfc, 0x1f, 0x00, 0x80, 0xff, 0x03, 0x00,
-   0xf0, 0x3f, 0x00, 0x80, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00,
-   0x80, 0xff, 0xff, 0xff, 0x01, 0x00, 0xfc, 0x0f, 0x00, 0xc0, 0xff, 0x03,
-   0x00, 0xf0, 0x3f, 0x00, 0x80, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x00, 0xfc, 0x0f, 0x00, 0xc0, 0xff,
-   0x07, 0x00, 0xe0, 0x3f, 0x00, 0x80, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x00, 0xfc, 0x07, 0x00, 0xe0,
-   0xff, 0x07, 0x00, 0xe0, 0x3f, 0x00, 0xc0, 0xff, 0xff, 0xff, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0x01, 0x00, 0xfc, 0x03, 0x00,
-   0xf0, 0xff, 0x0f, 0x00, 0xc0, 0x3f, 0x00, 0x80, 0xff, 0xff, 0x7f, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0x01, 0x00, 0xfc, 0x03,
-   0x00, 0xf0, 0xff, 0x0f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0xff, 0xff, 0x7f,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xff, 0x01, 0x00, 0xfc,
-   0x01, 0x00, 0xf8, 0xff, 0x1f, 0x00, 0x80, 0x3f, 0x00, 0x80, 0xff, 0xff,
-   0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xff, 0x01, 0x00,
-   0xfc, 0x01, 0x00, 0xf8, 0xff, 0x1f, 0x00, 0x80, 0x3f, 0x00, 0x80, 0xff,
-   0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0x01,
-   0x00, 0xfc, 0x00, 0x00, 0xfc, 0xff, 0x3f, 0x00, 0x00, 0x3f, 0x00, 0x80,
-   0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff,
-   0x01, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0xff, 0x3f, 0x00, 0x00, 0x3e, 0x00,
-   0xc0, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff,
-   0xff, 0x01, 0x00, 0x7c, 0x00, 0x00, 0xfe, 0xff, 0x7f, 0x00, 0x00, 0x3e,
-   0x00, 0x80, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0,
-   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff,
-   0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
-   0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xfc, 0xff,
-   0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x80,
-   0xfe, 0xff, 0x7f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x12, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+/***** Digit font: each glyph is 3 bytes (24 pixels) wide and 35 rows tall *****/
+#define DIGIT_GLYPH_WIDTH	3
+#define DIGIT_GLYPH_HEIGHT	35
+
+const glyph_t digitGlyphs[10] = {
+   { ZERO,  DIGIT_GLYPH_WIDTH, DIGIT_GLYPH_HEIGHT },
+   { ONE,   DIGIT_GLYPH_WIDTH, DIGIT_GLYPH_HEIGHT },
+   { TWO,   DIGIT_GLYPH_WIDTH, DIGIT_GLYPH_HEIGHT },
+   { THREE, DIGIT_GLYPH_WIDTH, DIGIT_GLYPH_HEIGHT },
+   { FOUR,  DIGIT_GLYPH_WIDTH, DIGIT_GLYPH_HEIGHT },
+   { FIVE,  DIGIT_GLYPH_WIDTH, DIGIT_GLYPH_HEIGHT },
+   { SIX,   DIGIT_GLYPH_WIDTH, DIGIT_GLYPH_HEIGHT },
+   { SEVEN, DIGIT_GLYPH_WIDTH, DIGIT_GLYPH_HEIGHT },
+   { EIGHT, DIGIT_GLYPH_WIDTH, DIGIT_GLYPH_HEIGHT },
+   { NINE,  DIGIT_GLYPH_WIDTH, DIGIT_GLYPH_HEIGHT }
 };
 
+const font_t digitFont = { digitGlyphs, '0', '9', DIGIT_GLYPH_WIDTH, DIGIT_GLYPH_HEIGHT };
 
-uint8_t screen [5000] = {
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x4e, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x7f, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x60,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
-   0x20, 0x1e, 0x1e, 0x3c, 0x0d, 0x9e, 0x06, 0x74, 0xc0, 0x31, 0xe0, 0xff,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x0c, 0x00, 0x1e, 0x1f, 0xbe, 0x1f, 0xdf, 0x0f, 0xff, 0xe1, 0xff, 0xe0,
-   0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x0c, 0x00, 0x0c, 0x0c, 0xf0, 0x10, 0x78, 0x88, 0x81, 0xc1, 0xc3,
-   0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x0c, 0x00, 0x0c, 0x0c, 0x38, 0x00, 0x1c, 0xc0, 0x80, 0xc3,
-   0xc0, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x0c, 0x18, 0x00, 0x0c, 0xc0, 0xff,
-   0xc3, 0xc0, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x0c, 0x18, 0x00, 0x0c, 0xe0,
-   0xff, 0xc3, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x0c, 0x18, 0x00, 0x0c,
-   0x60, 0x00, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x10, 0x06, 0x06, 0x0c, 0x00,
-   0x06, 0xe0, 0x00, 0xe0, 0x60, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x18, 0x0e, 0x07, 0x0c,
-   0x00, 0x06, 0xc0, 0x41, 0x61, 0x60, 0xc0, 0x40, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x0f, 0xfc, 0x8f,
-   0xff, 0xc1, 0xff, 0xc0, 0xff, 0xf9, 0xf1, 0xc0, 0x7f, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x03, 0x38,
-   0x8e, 0xff, 0xc1, 0xff, 0x00, 0x2e, 0xf8, 0xf8, 0x00, 0x17, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0x03, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0x01, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x8c, 0x01,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x8c,
-   0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-   0x8c, 0x01, 0x07, 0xcc, 0x18, 0x8e, 0x03, 0xe0, 0x00, 0x1e, 0x03, 0x3a,
-   0xc0, 0xff, 0xf1, 0xf0, 0xe0, 0x31, 0x80, 0x03, 0x80, 0x01, 0x00, 0x00,
-   0x30, 0x86, 0xe1, 0x3f, 0xfe, 0x7f, 0xff, 0x0f, 0xfc, 0x07, 0xff, 0x0f,
-   0xff, 0xc0, 0xff, 0xf0, 0xf8, 0xf0, 0xff, 0xf0, 0x1f, 0xc0, 0x01, 0x00,
-   0x00, 0x20, 0x86, 0x30, 0x30, 0x9c, 0x33, 0x1c, 0x1c, 0x06, 0x06, 0x7c,
-   0x04, 0xc0, 0x01, 0x03, 0x60, 0x60, 0xc0, 0x47, 0x18, 0x18, 0xc0, 0x00,
-   0x00, 0x00, 0x00, 0x06, 0x18, 0x70, 0x8c, 0x31, 0x1c, 0x18, 0x03, 0x0e,
-   0x1c, 0x00, 0x80, 0x01, 0x03, 0x60, 0x60, 0xc0, 0x01, 0x0c, 0x38, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x06, 0xf8, 0x7f, 0x8c, 0x31, 0x0e, 0x18, 0xff,
-   0x0f, 0x0c, 0x00, 0xfa, 0x00, 0x03, 0x60, 0x60, 0xc0, 0x00, 0xfc, 0x3f,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xfc, 0x7f, 0x8c, 0x31, 0x06, 0x98,
-   0xff, 0x0f, 0x0c, 0x80, 0xff, 0x00, 0x01, 0x60, 0x60, 0xc0, 0x00, 0xfe,
-   0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0c, 0x00, 0x86, 0x31, 0x06,
-   0x98, 0x01, 0x00, 0x0c, 0xc0, 0xc0, 0x80, 0x01, 0x60, 0x70, 0xc0, 0x00,
-   0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1c, 0x00, 0xc6, 0x30,
-   0x0e, 0x9c, 0x03, 0x00, 0x04, 0xe0, 0xc0, 0x80, 0x01, 0x30, 0x30, 0x40,
-   0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x18, 0x30, 0xc6,
-   0x18, 0x1e, 0x06, 0x03, 0x06, 0x06, 0x60, 0xf0, 0x80, 0x81, 0x70, 0x38,
-   0x60, 0x00, 0x0c, 0x18, 0x60, 0x00, 0x00, 0x00, 0xe0, 0x1f, 0xf8, 0xbf,
-   0xcf, 0x79, 0xf2, 0x07, 0xff, 0xc7, 0xff, 0xe0, 0xef, 0x81, 0xff, 0xe0,
-   0x7f, 0xfc, 0x0f, 0xfc, 0x1f, 0x70, 0x00, 0x00, 0x00, 0xf0, 0x1f, 0xe0,
-   0x85, 0xcf, 0x39, 0x63, 0x00, 0xbc, 0xc0, 0xff, 0x80, 0xe3, 0x01, 0x2e,
-   0xc0, 0x70, 0xfc, 0x0f, 0xf0, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x0f, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x0f, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x01,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe,
-   0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x8e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x06, 0x07, 0xf8, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x07, 0x07, 0xf8, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x06, 0x07, 0xfc, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x0e, 0x03, 0x70, 0x00, 0x0e, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x03, 0x70, 0x00, 0x0e, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x01, 0x70, 0x00, 0x06, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x70, 0x08, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x1c,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
-   0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x38, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x1c, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x03, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0x03,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xff,
-   0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0xa8, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x80, 0x92, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x50, 0x55, 0xa9, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x94, 0x92, 0x52, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x80, 0xaa, 0x54, 0x4a, 0x49, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xa5, 0x92, 0x92, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x92, 0x94, 0x54, 0xaa, 0x02, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x2a, 0xa5, 0xaa, 0x52, 0x09,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x55, 0x29, 0x89, 0x4a,
-   0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x52, 0x4a, 0x55,
-   0x92, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x4a, 0x55,
-   0x52, 0x55, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x52,
-   0x92, 0x4a, 0xaa, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xa4,
-   0x94, 0xaa, 0x94, 0x92, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x55, 0xa5, 0x94, 0xaa, 0xa4, 0x24, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x40, 0x49, 0xaa, 0x52, 0x92, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x20, 0x95, 0x84, 0x94, 0x54, 0x84, 0x24, 0x01, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x40, 0x12, 0x00, 0x50, 0x05, 0x00, 0xa8, 0x02, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x50, 0x05, 0x00, 0xa8, 0x04, 0x00, 0x48, 0x05, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x50, 0x0a, 0x00, 0x20, 0x05, 0x00, 0x90, 0x04,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x0a, 0x00, 0xa0, 0x02, 0x00, 0xa8,
-   0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x02, 0x00, 0x40, 0x02, 0x00,
-   0x50, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x0c, 0x00, 0x40, 0x01,
-   0x00, 0x48, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x01, 0x28, 0x40,
-   0x00, 0x05, 0x50, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x0d, 0x50,
-   0x80, 0x00, 0x0a, 0x48, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x02,
-   0x40, 0xa0, 0x00, 0x02, 0x28, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52,
-   0x05, 0xa8, 0x40, 0x80, 0x0a, 0x50, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x54, 0x0a, 0x90, 0x10, 0x80, 0x04, 0x48, 0x09, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x92, 0x0a, 0x28, 0x21, 0x40, 0x09, 0x50, 0x12, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0xa4, 0x02, 0xa0, 0x12, 0x40, 0x05, 0xa0, 0x2a, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x2a, 0x05, 0x28, 0x15, 0x20, 0x09, 0x28, 0x15, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x4a, 0x0a, 0xa0, 0x04, 0xa0, 0x02, 0x50, 0x12,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x04, 0x28, 0x05, 0x48, 0x05, 0xa8,
-   0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x0a, 0x48, 0x05, 0x50, 0x0a,
-   0x90, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x09, 0x50, 0x02, 0xa0,
-   0x04, 0xa8, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x05, 0x90, 0x02,
-   0x40, 0x05, 0x48, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x09, 0xa8,
-   0x00, 0x40, 0x0a, 0x90, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x05,
-   0x20, 0x01, 0x80, 0x02, 0x50, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54,
-   0x09, 0xa8, 0x00, 0x40, 0x0a, 0xa8, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x24, 0x05, 0xa0, 0x00, 0x80, 0x04, 0x48, 0x09, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x48, 0x09, 0x48, 0x80, 0x00, 0x09, 0x50, 0x15, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x50, 0x05, 0x28, 0x80, 0x00, 0x05, 0x90, 0x04, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x48, 0x0a, 0x10, 0x00, 0x01, 0x0a, 0x28, 0x09, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x90, 0x04, 0x20, 0x40, 0x01, 0x02, 0xa0, 0x02,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x09, 0x08, 0x20, 0x01, 0x04, 0xa8,
-   0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x0a, 0x10, 0xa0, 0x02, 0x08,
-   0x28, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x01, 0x08, 0x50, 0x0a,
-   0x04, 0x50, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x5a, 0x55, 0x95,
-   0x52, 0x55, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xaa, 0x52,
-   0xa5, 0x54, 0xaa, 0x4a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x92,
-   0x24, 0xa9, 0x4a, 0x91, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0xaa, 0xaa, 0x4a, 0x52, 0xa6, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x92, 0x4a, 0x92, 0x94, 0x28, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x24, 0xa9, 0xaa, 0x52, 0x4b, 0x15, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x54, 0x92, 0x54, 0x55, 0x2a, 0x09, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x50, 0x55, 0x49, 0x92, 0x54, 0x02, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x92, 0x52, 0x55, 0x49, 0x05, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x2a, 0x95, 0xa4, 0x52, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xa4, 0x52, 0x49, 0xaa,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x25, 0x95,
-   0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x54,
-   0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-   0x4a, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0xa8, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+
+//logo: 5000 bytes decoded, 1504 bytes stored
+#define LOGO_RLE_SIZE 1504
+const uint8_t logo_rle[LOGO_RLE_SIZE] = {
+   0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0xb4, 0x00, 0x02, 0x5f, 0xff, 0xfa,
+   0xec, 0x00, 0x04, 0x0f, 0xa0, 0x00, 0x05, 0xf8, 0xee, 0x00, 0x01, 0x01,
+   0xf0, 0xfe, 0x00, 0x00, 0x07, 0xee, 0x00, 0x00, 0x0e, 0xfc, 0x00, 0x00,
+   0xf8, 0xef, 0x00, 0x00, 0xf0, 0xfc, 0x00, 0x00, 0x06, 0xf0, 0x00, 0x00,
+   0x05, 0xfb, 0x00, 0x01, 0x01, 0xc0, 0xf1, 0x00, 0x00, 0x0a, 0xfa, 0x00,
+   0x00, 0x30, 0xf1, 0x00, 0x00, 0x70, 0xfa, 0x00, 0x00, 0x0e, 0xf2, 0x00,
+   0x01, 0x01, 0x80, 0xfa, 0x00, 0x01, 0x01, 0x80, 0xf3, 0x00, 0x00, 0x02,
+   0xf8, 0x00, 0x00, 0x60, 0xf3, 0x00, 0x00, 0x1c, 0xf8, 0x00, 0x00, 0x10,
+   0xf3, 0x00, 0x00, 0x20, 0xf8, 0x00, 0x00, 0x0c, 0xf3, 0x00, 0x00, 0xc0,
+   0xf8, 0x00, 0x00, 0x03, 0xf4, 0x00, 0x00, 0x01, 0xf6, 0x00, 0x00, 0x80,
+   0xf5, 0x00, 0x00, 0x06, 0xf6, 0x00, 0x00, 0x60, 0xf5, 0x00, 0x00, 0x08,
+   0xf6, 0x00, 0x00, 0x10, 0xf5, 0x00, 0x00, 0x30, 0xf6, 0x00, 0x00, 0x0c,
+   0xf5, 0x00, 0x00, 0x40, 0xf6, 0x00, 0x00, 0x02, 0xf5, 0x00, 0x00, 0x80,
+   0xf6, 0x00, 0x00, 0x01, 0xf6, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x80,
+   0xf7, 0x00, 0x00, 0x06, 0xf4, 0x00, 0x00, 0x60, 0xe9, 0x00, 0x00, 0x10,
+   0xf7, 0x00, 0x00, 0x18, 0xf4, 0x00, 0x00, 0x08, 0xf7, 0x00, 0x00, 0x20,
+   0xf4, 0x00, 0x00, 0x04, 0xf7, 0x00, 0x00, 0x40, 0xf4, 0x00, 0x00, 0x02,
+   0xe9, 0x00, 0x00, 0x01, 0xf8, 0x00, 0x01, 0x01, 0x80, 0xda, 0x00, 0x00,
+   0xc0, 0xf9, 0x00, 0x00, 0x02, 0xe9, 0x00, 0x00, 0x04, 0xf2, 0x00, 0x00,
+   0x20, 0xf9, 0x00, 0x00, 0x08, 0xf2, 0x00, 0x00, 0x10, 0xf9, 0x00, 0x00,
+   0x10, 0xf2, 0x00, 0x00, 0x08, 0xf9, 0x00, 0x00, 0x20, 0xf2, 0x00, 0x00,
+   0x04, 0xe0, 0x00, 0x00, 0x40, 0xf2, 0x00, 0x00, 0x02, 0xf9, 0x00, 0x00,
+   0x80, 0xf2, 0x00, 0x00, 0x01, 0xe1, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00,
+   0x80, 0xfb, 0x00, 0x00, 0x02, 0xf0, 0x00, 0x00, 0x40, 0xe2, 0x00, 0x00,
+   0x04, 0xf0, 0x00, 0x00, 0x20, 0xfb, 0x00, 0x00, 0x08, 0xf0, 0x00, 0x00,
+   0x10, 0xe2, 0x00, 0x00, 0x10, 0xff, 0x00, 0x00, 0x02, 0xfe, 0xff, 0x00,
+   0xe0, 0xfe, 0x00, 0x00, 0x07, 0xfe, 0xff, 0x00, 0xc0, 0xff, 0x00, 0x00,
+   0x08, 0xf8, 0x00, 0x04, 0x05, 0x24, 0x92, 0x49, 0x58, 0xfe, 0x00, 0x00,
+   0x18, 0xfe, 0x00, 0x00, 0x20, 0xf8, 0x00, 0x00, 0x20, 0xff, 0x00, 0x04,
+   0x08, 0x24, 0x92, 0x49, 0x44, 0xfe, 0x00, 0x00, 0x20, 0xfe, 0x00, 0x00,
+   0x18, 0xff, 0x00, 0x00, 0x04, 0xf8, 0x00, 0x00, 0x10, 0xfe, 0x00, 0x00,
+   0x02, 0xfe, 0x00, 0x00, 0x40, 0xf4, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00,
+   0x20, 0xfe, 0x00, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x80, 0xfe, 0x00, 0x00,
+   0x04, 0xff, 0x00, 0x00, 0x02, 0xf4, 0x00, 0x00, 0x01, 0xe9, 0x00, 0x03,
+   0x01, 0x80, 0x00, 0x01, 0xfd, 0x00, 0x00, 0x02, 0xff, 0x00, 0x00, 0x01,
+   0xfb, 0x00, 0x00, 0x80, 0xff, 0x00, 0x00, 0x40, 0xe4, 0x00, 0x02, 0x40,
+   0x00, 0x02, 0xf4, 0x00, 0x00, 0x01, 0xf7, 0x00, 0x00, 0x04, 0xf9, 0x00,
+   0x00, 0x80, 0xf4, 0x00, 0x00, 0x20, 0xf2, 0x00, 0x00, 0x02, 0xf9, 0x00,
+   0x00, 0x10, 0xf7, 0x00, 0x00, 0x40, 0xf2, 0x00, 0x00, 0x08, 0xeb, 0x00,
+   0x02, 0x08, 0x00, 0x10, 0xe0, 0x00, 0x00, 0x20, 0xfd, 0x00, 0x00, 0x04,
+   0xfe, 0x00, 0x0c, 0x40, 0x00, 0x2d, 0xb0, 0x00, 0x04, 0x00, 0x20, 0x00,
+   0x0d, 0xb4, 0x00, 0x02, 0xf5, 0x00, 0x03, 0x40, 0x00, 0x12, 0x48, 0xfc,
+   0x00, 0x03, 0x02, 0x48, 0x00, 0x02, 0xf0, 0x00, 0x04, 0x02, 0x00, 0x40,
+   0x00, 0x10, 0xf6, 0x00, 0x00, 0x08, 0xfb, 0x00, 0x00, 0x04, 0xfc, 0x00,
+   0x00, 0x20, 0xfb, 0x00, 0x00, 0x10, 0xf2, 0x00, 0x00, 0x80, 0xed, 0x00,
+   0x00, 0x02, 0xff, 0x00, 0x00, 0x01, 0xff, 0x00, 0x00, 0x40, 0xef, 0x00,
+   0x02, 0x01, 0x00, 0x02, 0xfe, 0x00, 0x00, 0x80, 0xff, 0x00, 0x00, 0x02,
+   0xf9, 0x00, 0x00, 0x10, 0xf9, 0x00, 0x01, 0x04, 0x02, 0xfc, 0x00, 0x00,
+   0x02, 0xfe, 0x00, 0x00, 0x08, 0xf5, 0x00, 0x00, 0x80, 0xeb, 0x00, 0x00,
+   0x20, 0xfe, 0x00, 0x02, 0x04, 0x00, 0x01, 0xef, 0x00, 0x02, 0x20, 0x00,
+   0x40, 0xff, 0x08, 0x01, 0x00, 0x02, 0xec, 0x00, 0x00, 0x10, 0xf2, 0x00,
+   0x00, 0x20, 0xfa, 0x00, 0x00, 0x20, 0xfe, 0x00, 0x00, 0x04, 0xfe, 0x00,
+   0x00, 0x02, 0xfe, 0x00, 0x00, 0x04, 0xf5, 0x00, 0x02, 0x10, 0x20, 0x10,
+   0xfc, 0x00, 0x00, 0x02, 0xef, 0x00, 0x02, 0x20, 0x00, 0x08, 0xfa, 0x00,
+   0x00, 0x04, 0xf5, 0x00, 0x01, 0x08, 0x40, 0xf7, 0x00, 0x00, 0x04, 0xf4,
+   0x00, 0x03, 0x80, 0x40, 0x00, 0x10, 0xed, 0x00, 0x00, 0x04, 0xfe, 0x00,
+   0x00, 0x20, 0xeb, 0x00, 0x00, 0x80, 0xfc, 0x00, 0x00, 0x02, 0xf1, 0x00,
+   0x00, 0x03, 0xfa, 0x00, 0x00, 0x02, 0xf0, 0x00, 0x00, 0x01, 0xff, 0x00,
+   0x00, 0x40, 0xec, 0x00, 0x00, 0x02, 0xff, 0x00, 0x00, 0x80, 0xf5, 0x00,
+   0x00, 0x40, 0xf4, 0x00, 0x02, 0x04, 0x00, 0x02, 0xf9, 0x00, 0x00, 0x40,
+   0xf9, 0x00, 0x02, 0x04, 0x00, 0x01, 0xff, 0x00, 0x02, 0x04, 0x00, 0x02,
+   0xf9, 0x00, 0x00, 0x40, 0xe9, 0x00, 0x00, 0x40, 0xf9, 0x00, 0x02, 0x08,
+   0x00, 0x02, 0xf4, 0x00, 0x00, 0x40, 0xf7, 0x00, 0x00, 0x04, 0xfd, 0x00,
+   0x00, 0x02, 0xf9, 0x00, 0x00, 0x40, 0xf9, 0x00, 0x00, 0x10, 0xfb, 0x00,
+   0x00, 0x02, 0xf0, 0x00, 0x02, 0x20, 0x00, 0x04, 0xd0, 0x00, 0x00, 0x02,
+   0xfd, 0x00, 0x00, 0x02, 0xf3, 0x00, 0x00, 0x20, 0xff, 0x00, 0x00, 0x40,
+   0xfb, 0x00, 0x00, 0x02, 0xf3, 0x00, 0x00, 0x20, 0xff, 0x00, 0x02, 0x80,
+   0x00, 0x01, 0xd3, 0x00, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x80, 0xfe, 0x00,
+   0x00, 0x02, 0xfe, 0x00, 0x00, 0x04, 0xfd, 0x00, 0x00, 0x20, 0xf6, 0x00,
+   0x00, 0x40, 0xfe, 0x00, 0x00, 0x02, 0xf9, 0x00, 0x00, 0x20, 0xfa, 0x00,
+   0x00, 0x02, 0xfe, 0x00, 0x02, 0x40, 0x00, 0x04, 0xfc, 0x00, 0x00, 0x04,
+   0xfd, 0x00, 0x00, 0x20, 0xf6, 0x00, 0x02, 0x60, 0x00, 0x04, 0xfc, 0x00,
+   0x00, 0x04, 0xf5, 0x00, 0x00, 0x04, 0xfa, 0x00, 0x00, 0x02, 0xf3, 0x00,
+   0x02, 0x20, 0x00, 0x08, 0xfe, 0x00, 0x00, 0x10, 0xfe, 0x00, 0x00, 0x02,
+   0xf3, 0x00, 0x00, 0x20, 0xf4, 0x00, 0x00, 0x08, 0xfd, 0x00, 0x00, 0x10,
+   0xfa, 0x00, 0x00, 0x10, 0xfe, 0x00, 0x00, 0x08, 0xf5, 0x00, 0x00, 0x10,
+   0xf2, 0x00, 0x00, 0x02, 0xf9, 0x00, 0x00, 0x10, 0xfa, 0x00, 0x00, 0x20,
+   0xfe, 0x00, 0x00, 0x04, 0xfe, 0x00, 0x00, 0x02, 0xef, 0x00, 0x00, 0x08,
+   0xf3, 0x00, 0x00, 0x08, 0xfa, 0x00, 0x04, 0x40, 0x00, 0x10, 0x00, 0x02,
+   0xfa, 0x00, 0x00, 0x10, 0xfd, 0x00, 0x00, 0x08, 0xfa, 0x00, 0x00, 0x80,
+   0xfe, 0x00, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x02, 0xf9, 0x00, 0x00, 0x08,
+   0xf8, 0x00, 0x00, 0x24, 0xfc, 0x00, 0x00, 0x02, 0xf2, 0x00, 0x00, 0x01,
+   0xff, 0x00, 0x00, 0x42, 0xff, 0x00, 0x01, 0x80, 0x04, 0xf7, 0x00, 0x00,
+   0x04, 0xf4, 0x00, 0x00, 0x04, 0xfc, 0x00, 0x00, 0x20, 0xf6, 0x00, 0x00,
+   0x02, 0xff, 0x00, 0x00, 0x81, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00,
+   0x02, 0xe9, 0x00, 0x00, 0x02, 0xfe, 0x00, 0x00, 0x40, 0xfd, 0x00, 0x00,
+   0x02, 0xfb, 0x00, 0x06, 0x04, 0x00, 0x01, 0x00, 0x80, 0x00, 0x20, 0xff,
+   0x00, 0x00, 0x02, 0xee, 0x00, 0x02, 0x40, 0x00, 0x10, 0xff, 0x00, 0x00,
+   0x02, 0xf2, 0x00, 0x02, 0x08, 0x00, 0x02, 0xf7, 0x00, 0x00, 0x80, 0xfd,
+   0x00, 0x00, 0x01, 0xf7, 0x00, 0x02, 0x20, 0x00, 0x08, 0xef, 0x00, 0x02,
+   0x10, 0x00, 0x04, 0xfb, 0x00, 0x00, 0x02, 0xf8, 0x00, 0x00, 0x80, 0xfc,
+   0x00, 0x06, 0x20, 0x00, 0x08, 0x00, 0x10, 0x00, 0x04, 0xff, 0x00, 0x00,
+   0x02, 0xff, 0x00, 0x00, 0x01, 0xec, 0x00, 0x00, 0x02, 0xf8, 0x00, 0x00,
+   0x40, 0xfc, 0x00, 0x06, 0x40, 0x00, 0x10, 0x00, 0x08, 0x00, 0x02, 0xff,
+   0x00, 0x00, 0x02, 0xff, 0x00, 0x00, 0x02, 0xe2, 0x00, 0x00, 0x20, 0xfc,
+   0x00, 0x06, 0x80, 0x00, 0x20, 0x00, 0x04, 0x00, 0x01, 0xfc, 0x00, 0x00,
+   0x04, 0xee, 0x00, 0x02, 0x80, 0x00, 0x02, 0xf8, 0x00, 0x00, 0x10, 0xfd,
+   0x00, 0x00, 0x01, 0xff, 0x00, 0x02, 0x40, 0x00, 0x02, 0xfd, 0x00, 0x00,
+   0x02, 0xff, 0x00, 0x00, 0x08, 0xf8, 0x00, 0x02, 0x7f, 0xff, 0xc1, 0xff,
+   0xff, 0x02, 0x80, 0x00, 0x01, 0xff, 0xff, 0x02, 0x83, 0xff, 0xfe, 0xff,
+   0x00, 0x00, 0x10, 0xfb, 0x00, 0x00, 0x08, 0xd0, 0x00, 0x00, 0x04, 0xf0,
+   0x00, 0x00, 0x20, 0xfb, 0x00, 0x00, 0x02, 0xf0, 0x00, 0x00, 0x40, 0xe9,
+   0x00, 0x00, 0x80, 0xfb, 0x00, 0x00, 0x01, 0xe8, 0x00, 0x00, 0x80, 0xf2,
+   0x00, 0x00, 0x01, 0xe9, 0x00, 0x00, 0x02, 0xf9, 0x00, 0x00, 0x40, 0xe9,
+   0x00, 0x00, 0x20, 0xf2, 0x00, 0x00, 0x04, 0xf9, 0x00, 0x00, 0x10, 0xf2,
+   0x00, 0x00, 0x08, 0xf9, 0x00, 0x00, 0x08, 0xf2, 0x00, 0x00, 0x10, 0xe0,
+   0x00, 0x00, 0x04, 0xf2, 0x00, 0x00, 0x60, 0xf9, 0x00, 0x00, 0x02, 0xe9,
+   0x00, 0x00, 0x01, 0xf2, 0x00, 0x00, 0x80, 0xf8, 0x00, 0x00, 0x80, 0xf4,
+   0x00, 0x00, 0x01, 0xf7, 0x00, 0x00, 0x40, 0xf4, 0x00, 0x00, 0x02, 0xf7,
+   0x00, 0x00, 0x20, 0xf4, 0x00, 0x00, 0x04, 0xf7, 0x00, 0x00, 0x10, 0xf4,
+   0x00, 0x00, 0x08, 0xf7, 0x00, 0x00, 0x0c, 0xf4, 0x00, 0x00, 0x30, 0xde,
+   0x00, 0x00, 0x03, 0xf4, 0x00, 0x00, 0xc0, 0xf6, 0x00, 0x00, 0x80, 0xf6,
+   0x00, 0x00, 0x01, 0xf5, 0x00, 0x00, 0x60, 0xf6, 0x00, 0x00, 0x02, 0xe9,
+   0x00, 0x00, 0x0c, 0xf5, 0x00, 0x00, 0x18, 0xe9, 0x00, 0x00, 0x06, 0xf6,
+   0x00, 0x00, 0x30, 0xf5, 0x00, 0x00, 0x01, 0xf6, 0x00, 0x00, 0xc0, 0xf4,
+   0x00, 0x00, 0xc0, 0xf8, 0x00, 0x00, 0x03, 0xf3, 0x00, 0x00, 0x20, 0xe9,
+   0x00, 0x00, 0x18, 0xf8, 0x00, 0x00, 0x1c, 0xf3, 0x00, 0x00, 0x06, 0xf8,
+   0x00, 0x00, 0x60, 0xf3, 0x00, 0x01, 0x01, 0x80, 0xfa, 0x00, 0x01, 0x01,
+   0x80, 0xf2, 0x00, 0x00, 0x60, 0xfa, 0x00, 0x00, 0x06, 0xf1, 0x00, 0x00,
+   0x18, 0xfa, 0x00, 0x00, 0x38, 0xf1, 0x00, 0x00, 0x07, 0xfa, 0x00, 0x00,
+   0xc0, 0xf0, 0x00, 0x00, 0xe0, 0xfc, 0x00, 0x00, 0x07, 0xef, 0x00, 0x00,
+   0x1e, 0xfc, 0x00, 0x00, 0x38, 0xef, 0x00, 0x01, 0x09, 0xc0, 0xfe, 0x00,
+   0x01, 0x07, 0xc0, 0xef, 0x00, 0x05, 0x0a, 0x3e, 0x80, 0x00, 0x01, 0x78,
+   0xee, 0x00, 0x05, 0x02, 0x01, 0x7f, 0xb7, 0xfe, 0x84, 0xeb, 0x00, 0x02,
+   0x4a, 0x80, 0x04, 0xeb, 0x00, 0x01, 0x02, 0x80, 0x81, 0x00, 0x81, 0x00,
+   0x81, 0x00, 0xff, 0x00
+};
+
+
+//screen: 5000 bytes decoded, 1294 bytes stored
+#define SCREEN_RLE_SIZE 1294
+const uint8_t screen_rle[SCREEN_RLE_SIZE] = {
+   0x81, 0x00, 0x81, 0x00, 0xb6, 0x00, 0x01, 0x01, 0x72, 0xf7, 0x00, 0x00,
+   0x40, 0xf5, 0x00, 0x01, 0x02, 0x8c, 0xf7, 0x00, 0x00, 0x80, 0xf5, 0x00,
+   0x01, 0x0d, 0xf0, 0xea, 0x00, 0x01, 0x16, 0x08, 0xe9, 0x00, 0x00, 0x02,
+   0xff, 0x78, 0x08, 0x3c, 0xb0, 0x79, 0x60, 0x2e, 0x03, 0x8c, 0x07, 0x3f,
+   0xf5, 0x00, 0x0c, 0x28, 0x04, 0x00, 0x80, 0x41, 0x48, 0x82, 0x90, 0xd1,
+   0x84, 0x73, 0x00, 0x01, 0xf3, 0x00, 0x0a, 0x48, 0xc8, 0x72, 0xf0, 0xe5,
+   0xe1, 0x7e, 0x04, 0x3c, 0x06, 0x7e, 0xf1, 0x00, 0x06, 0x13, 0x08, 0x26,
+   0x12, 0x80, 0x40, 0xc0, 0xf3, 0x00, 0x00, 0x50, 0xfe, 0x00, 0x04, 0x04,
+   0x00, 0x08, 0x00, 0xfe, 0xea, 0x00, 0x00, 0x04, 0xfe, 0x00, 0x01, 0x02,
+   0x80, 0xee, 0x00, 0x02, 0x01, 0xff, 0xc0, 0xf2, 0x00, 0x01, 0x50, 0x08,
+   0xff, 0x50, 0x06, 0x28, 0x00, 0x50, 0x01, 0x00, 0x04, 0x05, 0xf3, 0x00,
+   0x00, 0x08, 0xff, 0x10, 0x00, 0x80, 0xfe, 0x00, 0x02, 0x04, 0x82, 0x81,
+   0xff, 0x00, 0x00, 0x02, 0xf5, 0x00, 0x0c, 0x27, 0xe8, 0x4f, 0x11, 0xcf,
+   0x83, 0x9f, 0x00, 0x7d, 0x19, 0x89, 0x00, 0xfc, 0xf5, 0x00, 0x03, 0x1c,
+   0x30, 0x23, 0x80, 0xfe, 0x00, 0x05, 0x03, 0x8b, 0x80, 0x90, 0x03, 0x16,
+   0xf5, 0x00, 0x08, 0x03, 0xc0, 0x1c, 0x71, 0xff, 0x83, 0xff, 0x00, 0x74,
+   0xff, 0x1f, 0x01, 0x00, 0xe8, 0x81, 0x00, 0x81, 0x00, 0xb5, 0x00, 0x02,
+   0x07, 0xff, 0xc0, 0xf6, 0x00, 0x00, 0x20, 0xf5, 0x00, 0x00, 0x40, 0xf6,
+   0x00, 0x00, 0x40, 0xf7, 0x00, 0x01, 0x01, 0xce, 0xd1, 0x00, 0x00, 0x0a,
+   0xff, 0x00, 0x13, 0xe0, 0x33, 0x18, 0x71, 0xc0, 0x07, 0x00, 0x78, 0xc0,
+   0x5c, 0x03, 0x9f, 0x8f, 0x0f, 0x07, 0x8c, 0x01, 0xc0, 0x01, 0x80, 0xfe,
+   0x00, 0x0b, 0x50, 0x07, 0x1c, 0x4c, 0xe6, 0x8e, 0x30, 0x38, 0xe0, 0x87,
+   0x30, 0xa3, 0xff, 0x00, 0x06, 0x80, 0x10, 0x08, 0x73, 0x0e, 0x38, 0x02,
+   0xfe, 0x00, 0x16, 0x08, 0x00, 0x8b, 0xf0, 0x46, 0x32, 0xc7, 0xc8, 0x5f,
+   0x80, 0xc1, 0xd0, 0xfc, 0x83, 0x3f, 0x09, 0x19, 0x0c, 0x1d, 0x17, 0xe0,
+   0x00, 0x80, 0xff, 0x00, 0x0c, 0x04, 0x01, 0x14, 0x02, 0x08, 0x40, 0x00,
+   0x20, 0xa0, 0x10, 0x06, 0x20, 0x02, 0xfc, 0x00, 0x03, 0x62, 0x28, 0x04,
+   0x03, 0xfc, 0x00, 0x01, 0x07, 0xf0, 0xff, 0x00, 0x07, 0x48, 0x00, 0x3f,
+   0x80, 0x08, 0x00, 0x5e, 0x80, 0xfd, 0x00, 0x02, 0x80, 0x0f, 0xe0, 0xfb,
+   0x00, 0x00, 0x20, 0xfe, 0x00, 0x01, 0x10, 0x01, 0xfe, 0x00, 0x03, 0x01,
+   0xa0, 0x00, 0x40, 0xfd, 0x00, 0x00, 0x40, 0xfb, 0x00, 0x03, 0xa0, 0x0f,
+   0xfe, 0x50, 0xfe, 0x00, 0x05, 0x7f, 0xf0, 0x00, 0x02, 0xfc, 0x01, 0xff,
+   0x00, 0x00, 0x08, 0xff, 0x00, 0x01, 0x1f, 0xfc, 0xfb, 0x00, 0x09, 0x08,
+   0x00, 0x02, 0x80, 0x10, 0x20, 0x40, 0x00, 0x10, 0x04, 0xfe, 0x00, 0x04,
+   0x0a, 0x02, 0x01, 0x00, 0x10, 0xfa, 0x00, 0x13, 0x20, 0x0c, 0x00, 0x14,
+   0x08, 0x59, 0x00, 0x60, 0x40, 0x01, 0x0c, 0x00, 0x01, 0x02, 0x10, 0x04,
+   0x00, 0x40, 0x18, 0x06, 0xfe, 0x00, 0x15, 0x07, 0x38, 0x07, 0xf1, 0x90,
+   0x86, 0x37, 0x80, 0x3f, 0x83, 0x9f, 0x01, 0xf8, 0x80, 0x7e, 0x09, 0xe2,
+   0x39, 0xf0, 0x0f, 0xe0, 0x08, 0xfe, 0x00, 0x10, 0x08, 0x00, 0x18, 0x5c,
+   0x00, 0x02, 0x89, 0xe0, 0xc2, 0xe0, 0x00, 0x06, 0x30, 0x01, 0x8b, 0x04,
+   0xf0, 0xff, 0x00, 0x02, 0x30, 0xb8, 0x0a, 0xfe, 0x00, 0x15, 0x0f, 0xf8,
+   0x07, 0xa1, 0xf3, 0x9c, 0x06, 0x00, 0x3d, 0x03, 0xff, 0x01, 0xc7, 0x80,
+   0x74, 0x03, 0x0e, 0x3f, 0xf0, 0x0f, 0x40, 0x04, 0xc7, 0x00, 0x01, 0x07,
+   0x30, 0xd1, 0x00, 0x01, 0x07, 0xf0, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00,
+   0x81, 0x00, 0x9e, 0x00, 0x00, 0x0e, 0xe9, 0x00, 0x01, 0x31, 0x80, 0xea,
+   0x00, 0xff, 0x40, 0xea, 0x00, 0x00, 0x0e, 0xe9, 0x00, 0x04, 0x11, 0x20,
+   0x1f, 0xff, 0xf8, 0xed, 0x00, 0x00, 0x80, 0xfe, 0x00, 0x00, 0x08, 0xed,
+   0x00, 0x02, 0x80, 0x00, 0x20, 0xeb, 0x00, 0x04, 0x10, 0x20, 0x31, 0xff,
+   0x80, 0xed, 0x00, 0x00, 0x0f, 0xe9, 0x00, 0xff, 0x40, 0xff, 0x00, 0x00,
+   0x10, 0xed, 0x00, 0x04, 0x31, 0x80, 0x00, 0x10, 0x60, 0xed, 0x00, 0x00,
+   0x0e, 0xff, 0x00, 0x00, 0x28, 0xea, 0x00, 0x00, 0x12, 0xe9, 0x00, 0x01,
+   0x03, 0xc0, 0xd0, 0x00, 0x00, 0x08, 0xea, 0x00, 0x01, 0x03, 0x80, 0xea,
+   0x00, 0x00, 0x24, 0xe8, 0x00, 0x00, 0x50, 0xe9, 0x00, 0x00, 0x20, 0xf4,
+   0x00, 0x00, 0x60, 0xe9, 0x00, 0x00, 0x90, 0xe0, 0x00, 0x02, 0x01, 0xc7,
+   0xc0, 0xeb, 0x00, 0x00, 0x02, 0xf2, 0x00, 0x00, 0x30, 0xf7, 0x00, 0x00,
+   0x40, 0xf4, 0x00, 0x00, 0xc0, 0xf9, 0x00, 0x02, 0x03, 0xff, 0x80, 0x81,
+   0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0xfa, 0x00, 0x01,
+   0x15, 0x50, 0xeb, 0x00, 0x02, 0x01, 0x5c, 0x7a, 0xeb, 0x00, 0x03, 0x0b,
+   0xe3, 0xbf, 0xa0, 0xec, 0x00, 0x03, 0x23, 0xe3, 0xdf, 0xf4, 0xed, 0x00,
+   0x04, 0x01, 0x7c, 0x63, 0x18, 0xc6, 0xed, 0x00, 0x04, 0x01, 0xc7, 0x8f,
+   0x1b, 0xdb, 0xed, 0x00, 0x05, 0x05, 0xdb, 0x8c, 0x63, 0x1c, 0x40, 0xee,
+   0x00, 0x05, 0x0f, 0x1d, 0x8c, 0x7f, 0x1f, 0xd0, 0xee, 0x00, 0x05, 0x18,
+   0xfe, 0x31, 0xc4, 0x18, 0xc0, 0xee, 0x00, 0x05, 0x38, 0xe0, 0xc6, 0x3b,
+   0x1b, 0x18, 0xee, 0x00, 0x05, 0x63, 0x18, 0xf8, 0xe0, 0xe3, 0x1c, 0xee,
+   0x00, 0x05, 0xe3, 0x18, 0xe3, 0x18, 0xff, 0x70, 0xef, 0x00, 0x06, 0x01,
+   0x8f, 0x63, 0x1c, 0x7b, 0x1c, 0x71, 0xef, 0x00, 0x02, 0x01, 0x8f, 0x8c,
+   0xff, 0x7c, 0x02, 0x6c, 0x71, 0x80, 0xf0, 0x00, 0x07, 0x02, 0x38, 0xf0,
+   0x63, 0x1c, 0x70, 0x71, 0x80, 0xf0, 0x00, 0x02, 0x06, 0x3b, 0x74, 0xff,
+   0x63, 0x02, 0x74, 0x71, 0x80, 0xf0, 0x00, 0x07, 0x06, 0xe1, 0x21, 0x23,
+   0x8a, 0x21, 0x31, 0xc0, 0xf0, 0x00, 0x07, 0x08, 0xe8, 0x00, 0x1f, 0x80,
+   0x00, 0x07, 0xe0, 0xef, 0x00, 0x06, 0xf0, 0x00, 0x11, 0x80, 0x00, 0x1b,
+   0x80, 0xf0, 0x00, 0x00, 0x03, 0xff, 0x00, 0x04, 0x01, 0xe0, 0x00, 0x1c,
+   0x70, 0xf0, 0x00, 0x03, 0x1c, 0x10, 0x00, 0x07, 0xff, 0x00, 0x01, 0x1f,
+   0x10, 0xf0, 0x00, 0x01, 0x1c, 0x70, 0xff, 0x00, 0x03, 0xc0, 0x00, 0x18,
+   0xe8, 0xf0, 0x00, 0x07, 0x1d, 0xb0, 0x14, 0x00, 0x80, 0xa0, 0x18, 0xf8,
+   0xf0, 0x00, 0x07, 0x3e, 0x30, 0x1e, 0x03, 0x00, 0xf0, 0x18, 0xc0, 0xf0,
+   0x00, 0x07, 0x38, 0xf0, 0x08, 0x04, 0x00, 0x10, 0x06, 0x38, 0xf0, 0x00,
+   0x07, 0x58, 0xe0, 0x17, 0x07, 0x01, 0x10, 0x1e, 0xfc, 0xf0, 0x00, 0x07,
+   0x60, 0xf0, 0x1c, 0x0a, 0x00, 0x70, 0x18, 0xc4, 0xf0, 0x00, 0x07, 0x63,
+   0x00, 0x1d, 0x8c, 0x03, 0xb0, 0x18, 0xd8, 0xf0, 0x00, 0x07, 0x6c, 0x10,
+   0x11, 0xcc, 0x00, 0x30, 0x0f, 0x1c, 0xf0, 0x00, 0x07, 0x71, 0xe0, 0x11,
+   0xe0, 0x06, 0x30, 0x11, 0xfc, 0xf0, 0x00, 0x07, 0x06, 0xf0, 0x11, 0x88,
+   0x01, 0xd0, 0x1e, 0xe0, 0xf0, 0x00, 0x07, 0x47, 0x70, 0x11, 0x80, 0x17,
+   0xe0, 0x1f, 0x60, 0xf0, 0x00, 0x07, 0x40, 0x70, 0x06, 0x00, 0x18, 0xf0,
+   0x1c, 0x7c, 0xf0, 0x00, 0x07, 0x47, 0xc0, 0x18, 0xe0, 0x0f, 0x70, 0x1c,
+   0x70, 0xf0, 0x00, 0x07, 0x46, 0x30, 0x03, 0x00, 0x07, 0x80, 0x07, 0xb4,
+   0xf0, 0x00, 0x07, 0x46, 0x30, 0x1c, 0x40, 0x00, 0xf0, 0x1b, 0xc4, 0xf0,
+   0x00, 0x07, 0x06, 0x30, 0x11, 0x80, 0x03, 0x10, 0x03, 0x04, 0xf0, 0x00,
+   0x07, 0x3e, 0x30, 0x11, 0x80, 0x03, 0x10, 0x1f, 0x78, 0xf0, 0x00, 0x07,
+   0x0e, 0x30, 0x10, 0x00, 0x03, 0x70, 0x07, 0xb8, 0xf0, 0x00, 0x02, 0x36,
+   0x30, 0x17, 0xff, 0x01, 0x02, 0xb0, 0x18, 0x38, 0xf0, 0x00, 0x02, 0x18,
+   0x30, 0x06, 0xff, 0x00, 0x02, 0x30, 0x03, 0x88, 0xf0, 0x00, 0x07, 0x18,
+   0xf0, 0x1c, 0x01, 0x80, 0xf0, 0x1d, 0xb0, 0xf0, 0x00, 0x07, 0x1b, 0x70,
+   0x0c, 0x02, 0x00, 0x10, 0x11, 0xd0, 0xf0, 0x00, 0x06, 0x03, 0xb0, 0x14,
+   0x06, 0x00, 0x60, 0x10, 0xef, 0x00, 0x07, 0x0f, 0xc0, 0x18, 0x01, 0xc0,
+   0x30, 0x01, 0xe0, 0xf0, 0x00, 0x07, 0x07, 0xd0, 0x18, 0x0f, 0x10, 0x30,
+   0x1e, 0xe0, 0xf0, 0x00, 0x07, 0x03, 0xda, 0xba, 0xa3, 0x1a, 0x8a, 0xaf,
+   0x40, 0xf0, 0x00, 0x07, 0x03, 0x0f, 0xe0, 0x0c, 0x60, 0xff, 0xf7, 0x80,
+   0xf0, 0x00, 0x07, 0x03, 0x1c, 0x6e, 0x30, 0x78, 0xdc, 0x78, 0x80, 0xf0,
+   0x00, 0x06, 0x01, 0x1c, 0x71, 0xc7, 0x18, 0xec, 0x63, 0xee, 0x00, 0x05,
+   0x1c, 0x07, 0x1b, 0x63, 0x71, 0xed, 0xee, 0x00, 0x05, 0x6d, 0xc7, 0x1c,
+   0x63, 0xc6, 0x0c, 0xee, 0x00, 0x05, 0x0e, 0xdc, 0x7f, 0xe0, 0x86, 0x38,
+   0xee, 0x00, 0x05, 0x20, 0xe3, 0xb8, 0xe3, 0x7e, 0xd0, 0xee, 0x00, 0x05,
+   0x0b, 0xe3, 0xd8, 0xe3, 0xb8, 0xe0, 0xee, 0x00, 0x05, 0x03, 0x1d, 0xe3,
+   0x8f, 0xd8, 0xa0, 0xee, 0x00, 0x04, 0x03, 0x71, 0xe3, 0xb7, 0x1f, 0xed,
+   0x00, 0x04, 0x01, 0x71, 0xee, 0x3b, 0x1d, 0xec, 0x00, 0x03, 0x51, 0x8e,
+   0x03, 0xe8, 0xec, 0x00, 0x03, 0x04, 0x78, 0xe3, 0xa0, 0xec, 0x00, 0x02,
+   0x01, 0x47, 0x61, 0xea, 0x00, 0x01, 0x15, 0x28, 0xe5, 0x00
 };
 
 #endif /* SSD1608_DISPLAY_LUT_H_ */
@@ -0,0 +1,209 @@
+/*******************************************************************************
+* Copyright (C) Maxim Integrated Products, Inc., All rights Reserved.
+* 
+* This software is protected by copyright laws of the United States and
+* of foreign countries. This material may also be protected by patent laws
+* and technology transfer regulations of the United States and of foreign
+* countries. This software is furnished under a license agreement and/or a
+* nondisclosure agreement and may only be used or reproduced in accordance
+* with the terms of those agreements. Dissemination of this information to
+* any party or parties not specified in the license agreement and/or
+* nondisclosure agreement is expressly prohibited.
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL MAXIM INTEGRATED BE LIABLE FOR ANY CLAIM, DAMAGES
+* OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*
+* Except as contained in this notice, the name of Maxim Integrated
+* Products, Inc. shall not be used except as stated in the Maxim Integrated
+* Products, Inc. Branding Policy.
+*
+* The mere transfer of this software does not imply any licenses
+* of trade secrets, proprietary technology, copyrights, patents,
+* trademarks, maskwork rights, or any other form of intellectual
+* property whatsoever. Maxim Integrated Products, Inc. retains all
+* ownership rights.
+*******************************************************************************/
+/*
+*******************************************************************************
+* @file Temperature_History.c
+*
+* @version 1.0
+*
+* Started: 03/02/2021
+*
+* Updated: No current revisions
+*/
+
+#include "Temperature_History.h"
+
+/*
+ * @brief	Stores a reading in the ring buffer. Once the buffer is full the oldest reading is overwritten
+ * @param[(in)] <hist> { History to add to }
+ * @param[(in)] <centiF> { Temperature in hundredths of a degree Fahrenheit }
+ */
+void History_Add(temp_history_t *hist, int16_t centiF)
+{
+	hist->sample[hist->head].centiF = centiF;
+	hist->head = (hist->head + 1) % HISTORY_LENGTH;
+	if (hist->count < HISTORY_LENGTH)
+	{
+		hist->count++;
+	}
+}
+
+/*
+ * @brief	Looks up a stored reading by age
+ * @param[(in)] <hist> { History to read }
+ * @param[(in)] <age> { 0 = newest reading, count - 1 = oldest }
+ * @return     { Pointer to the reading, NULL if the history holds fewer than age + 1 readings }
+ */
+const temp_sample_t *History_Get(const temp_history_t *hist, uint16_t age)
+{
+	if (age >= hist->count)
+	{
+		return NULL;
+	}
+	return &hist->sample[(hist->head + HISTORY_LENGTH - 1 - age) % HISTORY_LENGTH];
+}
+
+/*
+ * @brief	Empties the history
+ */
+void History_Clear(temp_history_t *hist)
+{
+	hist->head = 0;
+	hist->count = 0;
+}
+
+/*
+ * @brief	Maps a temperature to a graph row. Readings outside min..max are drawn on the top or bottom row
+ * @return     { Row counted from the top of the graph }
+ */
+static uint8_t graphRow(const temp_graph_t *graph, int16_t centiF)
+{
+	int32_t v = centiF;
+	if (v < graph->min) v = graph->min;
+	if (v > graph->max) v = graph->max;
+	return (graph->height - 1) - (((v - graph->min) * (graph->height - 1)) / (graph->max - graph->min));
+}
+
+/*
+ * @brief	Sets the span of plot column i: from the previous reading's row to this reading's row, so the trace stays connected
+ * 			however far the temperature moved
+ * @return     { 1 if the column changed }
+ */
+static int graphColumn(temp_graph_t *graph, uint16_t i, uint8_t from, uint8_t to)
+{
+	uint8_t top = (from < to) ? from : to;
+	uint8_t bottom = (from < to) ? to : from;
+	int changed = (graph->top[i] != top || graph->bottom[i] != bottom);
+
+	graph->top[i] = top;
+	graph->bottom[i] = bottom;
+	return changed;
+}
+
+/*
+ * @brief	Rebuilds the whole plot. Readings fill the graph from the right edge, the newest in the last column
+ * @note       { #Graph_Push calls it itself when graph->shown is 0 }
+ * @param[(in)] <graph> { Graph region and scale }
+ * @param[(in)] <hist> { Readings to plot }
+ */
+void Graph_Draw(temp_graph_t *graph, const temp_history_t *hist)
+{
+	uint16_t n = (hist->count < graph->width) ? hist->count : graph->width;
+	uint8_t row = 0;
+
+	for (uint16_t i = 0; i < n; i++)
+	{
+		uint8_t next = graphRow(graph, History_Get(hist, n - 1 - i)->centiF);
+		graphColumn(graph, i, (i == 0) ? next : row, next);
+		row = next;
+	}
+	graph->shown = n;
+	graph->lastRow = row;
+}
+
+/*
+ * @brief	Adds the newest reading in the history to the plot
+ * @note       { Call once after each #History_Add. Once the graph is full the spans move one column left, the oldest drops off
+ * 			and only the new column is worked out. Falls back to #Graph_Draw when nothing is plotted yet }
+ * @param[(in)] <graph> { Graph region and scale }
+ * @param[(in)] <hist> { History the newest reading is taken from }
+ * @return     { 1 if any column changed, 0 if the graph rows look the same as before (e.g. a steady trace) }
+ */
+int Graph_Push(temp_graph_t *graph, const temp_history_t *hist)
+{
+	const temp_sample_t *newest = History_Get(hist, 0);
+	int changed = 0;
+
+	if (graph->shown == 0 || newest == NULL)
+	{
+		Graph_Draw(graph, hist);
+		return 1;
+	}
+
+	uint8_t row = graphRow(graph, newest->centiF);
+	if (graph->shown < graph->width)
+	{
+		graphColumn(graph, graph->shown++, graph->lastRow, row);
+		changed = 1;					//The trace got one column longer
+	}
+	else
+	{
+		for (uint16_t i = 0; i + 1 < graph->shown; i++)
+		{
+			changed |= graphColumn(graph, i, graph->top[i + 1], graph->bottom[i + 1]);
+		}
+		changed |= graphColumn(graph, graph->shown - 1, graph->lastRow, row);
+	}
+	graph->lastRow = row;
+	return changed;
+}
+
+/*
+ * @brief	Draws the graph's part of one row from the plotted spans. Rows outside the graph are left alone
+ * @note       { Works on any row in any order, e.g. only the graph band sent by #streamDisplayRows }
+ * @param[(in)] <graph> { Graph region, scale and plot }
+ * @param[(in)] <y> { Screen row being rendered }
+ * @param[(out)] <row> { The row's bytes, in display order }
+ */
+void Graph_Row(const temp_graph_t *graph, uint16_t y, uint8_t *row)
+{
+	int16_t r = y - graph->y;
+	int16_t x = graph->x + graph->width - graph->shown;
+	int16_t run = -1;				//First column of the trace run being collected
+
+	if (r < 0 || r >= graph->height)
+	{
+		return;
+	}
+
+	spanRow(row, graph->x, graph->x + graph->width - 1, !graph->color);
+	for (uint16_t i = 0; i < graph->shown; i++, x++)
+	{
+		int on = (r >= graph->top[i] && r <= graph->bottom[i]);
+
+		if (on && run < 0)
+		{
+			run = x;
+		}
+		else if (!on && run >= 0)
+		{
+			spanRow(row, run, x - 1, graph->color);
+			run = -1;
+		}
+	}
+	if (run >= 0)
+	{
+		spanRow(row, run, x - 1, graph->color);
+	}
+}
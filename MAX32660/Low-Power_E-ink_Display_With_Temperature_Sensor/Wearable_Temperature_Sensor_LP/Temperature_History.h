@@ -0,0 +1,145 @@
+/*******************************************************************************
+* Copyright (C) Maxim Integrated Products, Inc., All rights Reserved.
+* 
+* This software is protected by copyright laws of the United States and
+* of foreign countries. This material may also be protected by patent laws
+* and technology transfer regulations of the United States and of foreign
+* countries. This software is furnished under a license agreement and/or a
+* nondisclosure agreement and may only be used or reproduced in accordance
+* with the terms of those agreements. Dissemination of this information to
+* any party or parties not specified in the license agreement and/or
+* nondisclosure agreement is expressly prohibited.
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL MAXIM INTEGRATED BE LIABLE FOR ANY CLAIM, DAMAGES
+* OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*
+* Except as contained in this notice, the name of Maxim Integrated
+* Products, Inc. shall not be used except as stated in the Maxim Integrated
+* Products, Inc. Branding Policy.
+*
+* The mere transfer of this software does not imply any licenses
+* of trade secrets, proprietary technology, copyrights, patents,
+* trademarks, maskwork rights, or any other form of intellectual
+* property whatsoever. Maxim Integrated Products, Inc. retains all
+* ownership rights.
+*******************************************************************************/
+/*	NOTE: Temperature history for the "Wearable Temperature Sensor LP" project. Readings are kept in a
+*	fixed-size ring buffer and drawn as a trend graph (sparkline). The plot is kept as one vertical span per
+*	column and updated incrementally: a new reading shifts the spans one column left and adds only the new
+*	column. The rows are drawn from the spans while the frame is streamed to the display (see
+*	SSD1608_Stream.h), so no framebuffer is needed.
+*******************************************************************************
+* @file Temperature_History.h
+*
+* @version 1.0
+*
+* Started: 03/02/2021
+*
+* Updated: No current revisions
+*/
+
+#ifndef TEMPERATURE_HISTORY_H_
+#define TEMPERATURE_HISTORY_H_
+
+/***** Includes *****/
+#include <stdint.h>
+#include "SSD1608_Display.h"
+
+/***** History Config *****/
+#define HISTORY_LENGTH			136		//Readings kept, one graph column each
+
+/***** Types *****/
+typedef struct {
+	int16_t centiF;				//Temperature in hundredths of a degree Fahrenheit
+} temp_sample_t;
+
+typedef struct {
+	temp_sample_t sample[HISTORY_LENGTH];
+	uint16_t head;				//Slot the next reading goes into
+	uint16_t count;				//Readings held (up to HISTORY_LENGTH)
+} temp_history_t;
+
+typedef struct {
+	int16_t x;					//Left edge
+	int16_t y;					//Top row
+	int16_t width;				//Columns, at most HISTORY_LENGTH
+	int16_t height;				//Rows, at most 256
+	int16_t min;				//Temperature drawn on the bottom row (centi-degrees)
+	int16_t max;				//Temperature drawn on the top row (centi-degrees)
+	uint8_t color;				//Trace color, the background is the other one
+	uint16_t shown;				//Columns plotted, 0 = plot needs rebuilding from the history
+	uint8_t lastRow;			//Row of the newest plotted reading
+	uint8_t top[HISTORY_LENGTH];	//Span of each plotted column, rows from the top of the graph, oldest column first
+	uint8_t bottom[HISTORY_LENGTH];
+} temp_graph_t;
+
+/**
+ * @brief Ring buffer of temperature readings and a trend graph for the
+ * SSD1608 display. The history is a plain variable: deep sleep keeps SRAM powered
+ * (#LP_EnableRamRetReg), so it survives #LP_EnterDeepSleepMode.
+ *
+ * @code
+ *
+ * static temp_history_t history;
+ * static temp_graph_t graph = { .x = 0, .y = 140, .width = 136, .height = 56, .min = 7000, .max = 10500, .color = 1 };
+ *
+ * static void graphRows(uint16_t y, uint8_t *row, void *ctx)
+ * {
+ *	Graph_Row(&graph, y, row);
+ * }
+ *
+ * streamBackground(screen_rle, SCREEN_RLE_SIZE);
+ * streamAddRows(graph.y, graph.height, graphRows, NULL);
+ * while(1)
+ * {
+ *	History_Add(&history, centiF);
+ *	if (Graph_Push(&graph, &history))			//Shift the plot and add the new column
+ *	{
+ *		streamDisplayRows(&display, graph.y, graph.y + graph.height - 1, 0);		//Sends the graph rows only
+ *	}
+ * }
+ *
+ * @endcode
+ */
+
+/***** Functions *****/
+
+/**
+ * @brief	Stores a reading, overwriting the oldest one once the history is full
+ */
+void History_Add(temp_history_t *hist, int16_t centiF);
+
+/**
+ * @brief	Returns a stored reading, 0 = newest. NULL if there are not that many readings
+ */
+const temp_sample_t *History_Get(const temp_history_t *hist, uint16_t age);
+
+/**
+ * @brief	Empties the history
+ */
+void History_Clear(temp_history_t *hist);
+
+/**
+ * @brief	Rebuilds the whole plot from the history
+ */
+void Graph_Draw(temp_graph_t *graph, const temp_history_t *hist);
+
+/**
+ * @brief	Adds the newest reading to the plot by shifting it one column left. Returns 1 if the plot looks different
+ */
+int Graph_Push(temp_graph_t *graph, const temp_history_t *hist);
+
+/**
+ * @brief	Draws the graph's part of a row that is being streamed to the display
+ */
+void Graph_Row(const temp_graph_t *graph, uint16_t y, uint8_t *row);
+
+#endif /* TEMPERATURE_HISTORY_H_ */
@@ -60,229 +60,303 @@
 
 #include "Wearable_Temperature_Sensor_LP.h"
 #include "SSD1608_Display.h"
+#include "SSD1608_Stream.h"
 #include "SSD1608_Display_LUT.h"
+#include "Temperature_History.h"
+#include "LP_Scheduler.h"
+#include "Adaptive_Sampler.h"
 
-/***** LUT Arrays holding buffer update information. Each array holds a bitmap for each number *****/
-uint8_t ONE [];
-uint8_t TWO [];
-uint8_t THREE [];
-uint8_t FOUR [];
-uint8_t FIVE [];
-uint8_t SIX [];
-uint8_t SEVEN [];
-uint8_t EIGHT [];
-uint8_t NINE [];
-uint8_t ZERO [];
-uint8_t logo [];			//Holds data for Maxim Logo bitmap
-uint8_t screen [];			//Holds data for background image of temperature sensor display screen
+/***** Variables *****/
+uint8_t val[5];
+volatile uint8_t buttonPressed;		//1 = low-power mode (deep sleep between tasks), toggled by the push-button
+static uint8_t lowPower;			//Mode the scheduler is currently in
+ssd1608_t display = SSD1608_EVKIT_PANEL(NULL);		//Frames are streamed (see #BufferUpdate), no framebuffer
+static temp_history_t history;		//Readings behind the trend graph, kept through deep sleep
+static temp_graph_t trendGraph = {
+	.x = GRAPH_X,
+	.y = GRAPH_Y,
+	.width = GRAPH_WIDTH,
+	.height = GRAPH_HEIGHT,
+	.min = GRAPH_TEMP_MIN,
+	.max = GRAPH_TEMP_MAX,
+	.color = 1					//Background of "screen" is 0
+};
+
+/***** Tasks *****/
+static void senseTask(void *ctx);
+static void convertTask(void *ctx);
+static void readTask(void *ctx);
+static void showTask(void *ctx);
+static void refreshTask(void *ctx);
+static sched_task_t task_sense = { .name = "sense", .run = senseTask, .period = SENSE_PERIOD_MIN_MS };		//Period set by the sampler
+static sched_task_t task_convert = { .name = "convert", .run = convertTask, .period = 0 };		//Posted when the one-shot command is written
+static sched_task_t task_read = { .name = "read", .run = readTask, .period = 0 };				//Run by convertTask
+static sched_task_t task_show = { .name = "show", .run = showTask, .period = 0 };				//Posted when the reading is in
+static sched_task_t task_refresh = { .name = "refresh", .run = refreshTask, .period = 0 };		//Run by showTask
+static volatile int sensorError;	//Result of the last sensor transfer, set by the completion callbacks
+static int16_t reading;				//Temperature register (Q8), written by DMA
+static uint32_t senseMs;			//#Sched_Now time of the last sense, the next one is counted from it
+static sampler_t sampler = {
+	.minPeriod = SENSE_PERIOD_MIN_MS,
+	.maxPeriod = SENSE_PERIOD_MAX_MS,
+	.band = SENSE_BAND_CENTI,
+	.slope = SENSE_SLOPE_CENTI
+};
 
 /*
- * @brief	Checks for RTC alarm flags and then clears them once set
+ * @brief	Toggles between active mode and low-power mode every time the button on MAX32660 is pressed.
+ * @note       { Runs in the GPIO interrupt, which also wakes the micro from deep sleep. The new mode is applied by the next sense task }
+ * @param[(in)] <pb> { void pointer to button  on MAX32660 microcontroller}
  */
-void alarmHandler(void)
+void buttonHandler(void *pb)
 {
+    buttonPressed ^= 1;
+}
 
-    int flags = RTC_GetFlags();
-    alarmed = 1;
+/*
+ * @brief	Splits given number into each significant tens place (e.g hundreds, tens, ones, etc.)
+ * @note       { Integer division only. Temperatures below 0 are shown as 000.00, the digit font has no minus sign }
+ * @param[(in)] <centiF> { Temperature in hundredths of a degree Fahrenheit, see #MAX30205_Q8ToCentiF }
+ */
+void TempValues (int16_t centiF)
+{
+	uint16_t temp = (centiF < 0) ? 0 : centiF;
+	val[0] = temp / 10000;				//Hold hundreds place
+	val[1] = (temp / 1000) % 10;		//Hold tens place value
+	val[2] = (temp / 100) % 10;			//Hold ones place value
+	val[3] = (temp / 10) % 10;			//Hold tenths place value
+	val[4] = temp % 10;					//Hold hundreths place value
+}
 
-    if (flags & MXC_F_RTC_CTRL_ALSF) {
-        RTC_ClearFlags(MXC_F_RTC_CTRL_ALSF);
-    }
+static char wholeText[4];			//Digits in front of the decimal point, drawn by the next #refreshTask
+static char fractionText[3];		//Digits after the decimal point
+static uint8_t shown[5];			//Digits of the last frame built (0xFF = none yet, see #StartScreen)
+static int16_t bandY0 = SCREEN_HEIGHT;	//Rows the next #refreshTask sends (empty when bandY0 > bandY1)
+static int16_t bandY1 = -1;
 
-    if (flags & MXC_F_RTC_CTRL_ALDF) {
-        RTC_ClearFlags(MXC_F_RTC_CTRL_ALDF);
-    }
+/*
+ * @brief	Grows the band of rows the next #refreshTask sends
+ */
+static void bandAdd(int16_t y0, int16_t y1)
+{
+	if (y0 < bandY0) bandY0 = y0;
+	if (y1 > bandY1) bandY1 = y1;
 }
 
 /*
- * @brief	Initialize RTC and prepare UART for deep-sleep
- * @param[(in)] <waitForTrigger> { Integer to decide whether system should wait for trigger or not }
+ * @brief	Draws the trend graph's part of a row while the frame is streamed, see #streamAddRows
  */
-void setTrigger(int waitForTrigger)
+static void graphRows(uint16_t y, uint8_t *row, void *ctx)
 {
-    alarmed = 0;
-    sys_cfg_rtc_t sys_cfg;
-    sys_cfg.tmr = MXC_TMR0;
-    while(RTC_Init(MXC_RTC, 0, 0, &sys_cfg) == E_BUSY);
-    while(RTC_SetTimeofdayAlarm(MXC_RTC, DELAY_IN_SEC) == E_BUSY);
-    while(RTC_EnableRTCE(MXC_RTC) == E_BUSY);
-    if(waitForTrigger)
-    {
-        while(!alarmed);
-    }
-
-    // Wait for serial transactions to complete.
-    while(UART_PrepForSleep(MXC_UART_GET_UART(CONSOLE_UART)) != E_NO_ERROR);
+	Graph_Row(&trendGraph, y, row);
 }
 
-
 /*
- * @brief	Function that increments global variable (buttonPressed) everytime that the button on MAX32660 is pressed.
- * @param[(in)] <pb> { void pointer to button  on MAX32660 microcontroller}
+ * @brief	Builds the next frame from the pre-calculated template and digit font (LUT)
+ * @note       { Must first call #TempValues to split the temperature into digits. Nothing is drawn here: the frame is a list of
+ * #streamDisplay overlays that #refreshTask renders row by row as it is sent, so no framebuffer is needed. The "screen" template
+ * is the background, the digits are drawn from y=80 to y=114, 3 bytes (24 pixels) per digit, the whole part at WHOLE_DIGITS_X
+ * and the fraction at FRACTION_DIGITS_X, on either side of the decimal point in "screen". A leading zero in the hundreds place
+ * is left blank. The trend graph rows (GRAPH_X, GRAPH_Y, GRAPH_WIDTH x GRAPH_HEIGHT) come from the history, see #TrendUpdate.
+ * The digits are compared with those of the last frame: only when one changed are the digit rows (DIGIT_UPDATE_Y_START to
+ * DIGIT_UPDATE_Y_END) added to the band #refreshTask sends }
+ * @param[(in)] <pos> { Array of integer values of each ten's place in temperature (e.g hundreds, tens, ones, etc) }
+ * @return     { 1 if any digit differs from the last frame, 0 if the digits look the same }
  */
-void buttonHandler(void *pb)
+int BufferUpdate (uint8_t *pos)
 {
-    buttonPressed++;
+	int changed = (memcmp(pos, shown, sizeof(shown)) != 0);
+
+	if (changed)
+	{
+		memcpy(shown, pos, sizeof(shown));
+		bandAdd(DIGIT_UPDATE_Y_START, DIGIT_UPDATE_Y_END);
+	}
+
+	wholeText[0] = (pos[0] == 0) ? ' ' : '0' + pos[0];		//Characters outside the font draw as a blank cell
+	wholeText[1] = '0' + pos[1];
+	wholeText[2] = '0' + pos[2];
+	wholeText[3] = '\0';
+	fractionText[0] = '0' + pos[3];
+	fractionText[1] = '0' + pos[4];
+	fractionText[2] = '\0';
+
+	streamClear();
+	streamBackground(screen_rle, SCREEN_RLE_SIZE);
+	streamAddString(WHOLE_DIGITS_X, DIGIT_UPDATE_Y_START, &digitFont, wholeText);
+	streamAddString(FRACTION_DIGITS_X, DIGIT_UPDATE_Y_START, &digitFont, fractionText);
+	streamAddRows(GRAPH_Y, GRAPH_HEIGHT, graphRows, NULL);
+	return changed;
 }
 
 /*
- * @brief	Provides the Look Up Table data for a specified number so that it can be added into buffer1
- * @note       { Called internally within #BufferUpdate }
- * @param[(in)] <number> { Value from temperature digit that is going to be dispalyed onto screen }
- * @return     { pointer to Look Up Table array that holds bitmap for input value }
+ * @brief	Stores a reading in the history and adds it to the trend graph below the digits
+ * @note       { The plot is shifted one column and only the new column is worked out (#Graph_Push). When that changes the plot,
+ * the graph rows (GRAPH_Y to GRAPH_Y + GRAPH_HEIGHT - 1) are added to the band #refreshTask sends. The history and the plot
+ * live in SRAM, which deep sleep retains }
+ * @param[(in)] <centiF> { Temperature in hundredths of a degree Fahrenheit, see #MAX30205_Q8ToCentiF }
+ * @return     { 1 if the graph looks different, 0 if it does not }
  */
-uint8_t *NumberFinder(int number)
+int TrendUpdate(int16_t centiF)
 {
-	switch(number)
+	History_Add(&history, centiF);
+	if (!Graph_Push(&trendGraph, &history))
 	{
-		case 0:
-			return(ZERO);
-			break;
-		case 1:
-			return(ONE);
-			break;
-		case 2:
-			return(TWO);
-			break;
-		case 3:
-			return(THREE);
-			break;
-		case 4:
-			return(FOUR);
-			break;
-		case 5:
-			return(FIVE);
-			break;
-		case 6:
-			return(SIX);
-			break;
-		case 7:
-			return(SEVEN);
-			break;
-		case 8:
-			return(EIGHT);
-			break;
-		case 9:
-			return(NINE);
-			break;
-		default:
-			return(ZERO);
-			break;
+		return 0;
 	}
+	bandAdd(GRAPH_Y, GRAPH_Y + GRAPH_HEIGHT - 1);
+	return 1;
 }
 
+/*
+ * @brief	Completion callback of the one-shot command. Runs in the I2C interrupt and hands the result to #convertTask
+ * @param[(in)] <error> { E_NO_ERROR, or E_COMM_ERR if the sensor did not answer }
+ */
+static void oneShotDone(int error)
+{
+	sensorError = error;
+	Sched_Post(&task_convert);
+}
 
 /*
- * @brief	Splits given number into each significant tens place (e.g hundreds, tens, ones, etc.)
- * @param[(in)] <temp> { Temperature read from MAX30205 sensor and converted using #MAX30205_CtoF }
+ * @brief	Completion callback of the temperature register read, see #oneShotDone
  */
-void TempValues (double temp)
+static void readDone(int error)
 {
-	int hold = temp/100;
-	int rem = trunc(hold);
-	val[0] = rem;				//Hold hundreds place
-	hold = trunc(temp / 10);
-	rem = (hold % 10);
-	val[1]=rem;					//Hold tens place value
-	hold = trunc(temp);
-	rem = hold % 10;
-	val[2]=rem;					//Hold ones place value
-	hold = trunc(temp*10);
-	rem = hold % 10;
-	val[3]=rem;					//Hold tenths place value
-	hold = trunc(temp*100);
-	rem = hold % 10;
-	val[4]=rem;					//Hold hundreths place value
+	sensorError = error;
+	Sched_Post(&task_show);
 }
 
-int flag = 0;	//Initializing flag
 /*
- * @brief	Updates buffer based on pre-calculated template and pre-calculated numbers (LUT)
- * @note       { Must first call #TempValues in order to find each digit that must be updated in buffer1. Each digit being updated on screen is within Y range of
- * from y=80 and y = 115. Each digit is 4 bytes long on X axis, which is 32 pixels. (hundres digit from x= 1 - x = 3; tens digit from x = 4 - x = 6; etc.)}	
- * @param[(in)] <pos> { Array of integer values of each ten's place in temperature (e.g hundreds, tens, ones, etc) }
+ * @brief	Sense task: applies the mode chosen with the push-button and starts a temperature conversion
+ * @note       { The one-shot command goes out by DMA; #convertTask is posted when it is on the sensor. Nothing waits in a loop }
  */
-void BufferUpdate (uint8_t *pos)
+static void senseTask(void *ctx)
 {
-	if (flag == 0)
+	if (buttonPressed != lowPower)
 	{
-		for (int z = 0;z<ARRAY_SIZE;z++)
+		lowPower = buttonPressed;
+		if (lowPower)
+		{
+			Sched_DeepSleepUnlock();
+		}
+		else
 		{
-			buffer1[z] = screen[z];
+			Sched_DeepSleepLock();
 		}
-		flag = 1;
 	}
-	uint8_t num;
-	uint8_t *p;
-	int big1=0, big2=0, big3=0, big4=0, big5=0;
-	for(int y=DIGIT_UPDATE_Y_START;y<DIGIT_UPDATE_Y_END;y++)
+
+	senseMs = Sched_Now();
+	Sched_Expect(&task_convert);		//No deep sleep while the I2C transfer runs
+	if (MAX30205_OneShotSenseAsync(oneShotDone) != E_NO_ERROR)
 	{
-		for(int x=DIGIT_UPDATE_X_START;x<DIGIT_UPDATE_X_END;x++)
+		Sched_Cancel(&task_convert);	//Try again next period
+	}
+}
+
+/*
+ * @brief	Convert task: the sensor is converting. Sleeps through the conversion by scheduling #readTask for when it is done
+ * @note       { Nothing else is pending for MAX30205_CONVERSION_MS, so in low-power mode the micro spends it in deep sleep
+ * with the RTC alarm as the wake-up }
+ */
+static void convertTask(void *ctx)
+{
+	if (sensorError == E_NO_ERROR)
+	{
+		Sched_RunIn(&task_read, MAX30205_CONVERSION_MS);
+	}
+}
+
+/*
+ * @brief	Read task: starts reading the result by DMA; #showTask is posted when it is in
+ */
+static void readTask(void *ctx)
+{
+	Sched_Expect(&task_show);
+	if (MAX30205_TempReadQ8Async(&reading, readDone) != E_NO_ERROR)
+	{
+		Sched_Cancel(&task_show);
+	}
+}
+
+/*
+ * @brief	Show task: builds the frame for the new temperature (digits and trend graph) and picks when the next reading
+ * is taken
+ * @note       { The sampler lengthens the sense period while the temperature is steady and shortens it when it moves. The
+ * display is refreshed right after a reading that changed a digit or the graph; otherwise nothing is sent. If the sensor did
+ * not answer, the screen is kept and the period too }
+ */
+static void showTask(void *ctx)
+{
+	if (sensorError == E_NO_ERROR)
+	{
+		int16_t centiF = MAX30205_Q8ToCentiF(reading);		//Fixed point, no soft-float or libm
+		TempValues(centiF);
+		int changed = BufferUpdate(val);
+		changed |= TrendUpdate(centiF);
+
+		task_sense.period = Sampler_Update(&sampler, Sched_Now(), centiF);
+		if (changed)
 		{
-			int index = x + (y * 25);
-			if( y>=80 && y<115)
-			{
-				if(x>HUNDREDS_DIGIT_START && x<HUNDREDS_DIGIT_END && pos[0] != 0)
-				{
-					num = pos[0];
-					p = NumberFinder(num);
-					buffer1[index]= p[big1];
-					big1++;
-				}
-				else if(x>TENS_DIGIT_START && x<TENS_DIGIT_END)
-				{
-					num = pos[1];
-					p = NumberFinder(num);
-					buffer1[index]= p[big2];
-					big2++;
-				}
-				else if(x>ONES_DIGIT_START && x<ONES_DIGIT_END)
-				{
-					num = pos[2];
-					p = NumberFinder(num);
-					buffer1[index]=p[big3];
-					big3++;
-				}
-				else if(x>TENTHS_DIGIT_START && x<TENTHS_DIGIT_END)
-				{
-					num = pos[3];
-					p = NumberFinder(num);
-					buffer1[index]=p[big4];
-					big4++;
-				}
-				else if(x>HUNDRETHS_DIGIT_START && x<HUNDRETHS_DIGIT_END)
-				{
-					num = pos[4];
-					p = NumberFinder(num);
-					buffer1[index]= p[big5];
-					big5++;
-				}
-				else
-				{
-						buffer1[index]= screen[index];
-				}
-			}
-			else
-			{
-				buffer1[index]= screen[index];
-			}
+			Sched_RunIn(&task_refresh, 0);
 		}
 	}
+
+	uint32_t elapsed = Sched_Now() - senseMs;
+	Sched_RunIn(&task_sense, (elapsed < task_sense.period) ? task_sense.period - elapsed : 0);		//Counted from this reading's sense
+}
+
+/*
+ * @brief	Refresh task: renders the frame built by #BufferUpdate straight to the display
+ * @note       { Only the band of rows that #BufferUpdate and #TrendUpdate marked is rendered and sent (twice, for both RAM banks
+ * of the partial waveform): the digit rows only when a digit changed. The first frame is sent whole with the full waveform.
+ * #streamDisplayRows sleeps while the panel is busy }
+ */
+static void refreshTask(void *ctx)
+{
+	if (bandY0 > bandY1)
+	{
+		return;
+	}
+	streamDisplayRows(&display, bandY0, bandY1, 0);
+	bandY0 = SCREEN_HEIGHT;
+	bandY1 = -1;
+}
+
+/*
+ * @brief	Registers the sense, convert, read, show and refresh tasks with the scheduler. Call after #Sched_Init, then run #Sched_Run
+ * @note       { Starts in active mode (deep sleep locked) like the original loop; the first press of the push-button allows deep
+ * sleep between tasks. The first reading is taken FIRST_SENSE_MS after the start screen }
+ */
+void TasksStart(void)
+{
+	Sched_DeepSleepLock();
+	lowPower = 0;
+	buttonPressed = 0;
+	Sampler_Reset(&sampler);
+
+	Sched_Add(&task_sense, FIRST_SENSE_MS);
+	Sched_Add(&task_convert, 0);
+	Sched_Add(&task_read, 0);
+	Sched_Add(&task_show, 0);
+	Sched_Add(&task_refresh, 0);
 }
 
 /*
- * @brief	Send a start screen to the display as temperature sensor is being configured. Sends data from "logo" array in LUT
+ * @brief	Send a start screen to the display as temperature sensor is being configured. Streams the compressed "logo_rle" array from the LUT
  */
 void StartScreen(void)
 {
-	  powerUp();
-	  setRAM(0, 0);
-	  writeRAM();
+	  powerUp(&display);
+	  setRAM(&display, 0, 0);
+	  writeRAM(&display);
 
-	  GPIO_OutSet(&dc);
-	  BitMapTransfer(logo, ARRAY_SIZE);		//Send logo screen information to display
+	  GPIO_OutSet(&display.dc);
+	  BitMapTransferRLE(&display, logo_rle, LOGO_RLE_SIZE, ARRAY_SIZE);		//Decode logo screen straight to the display
 
-	  GPIO_OutSet(&cs);
-	  updateScreen();
+	  GPIO_OutSet(&display.cs);
+	  updateScreen(&display);
+	  displaySleep(&display);		//Logo stays up while the sensor is configured, the first streamed frame replaces it
+	  memset(shown, 0xFF, sizeof(shown));
 }
 
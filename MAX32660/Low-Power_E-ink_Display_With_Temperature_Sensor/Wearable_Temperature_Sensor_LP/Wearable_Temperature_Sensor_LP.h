@@ -73,43 +73,46 @@
 #include "pb.h"
 #include "uart.h"
 #include "SSD1608_Display.h"
+#include "LP_Scheduler.h"
+#include "MAX30205_Sensor.h"
 
 /***** Definitions *****/
-#define SUBSECOND_MSEC_0    125
-#define SUBSECOND_MSEC_1    250
-#define MSEC_TO_RSSA(x) (0 - ((x * 256) / 1000)) /* Converts a time in milleseconds to the equivalent RSSA register value. */
-#define DELAY_IN_SEC	7		/* Corresponds to duration microcontroller is left in deep-sleep mode */
-
-#define	HUNDREDS_DIGIT_START		0
-#define	HUNDREDS_DIGIT_END			4
-#define	TENS_DIGIT_START			3
-#define TENS_DIGIT_END				7
-#define ONES_DIGIT_START			6
-#define ONES_DIGIT_END				10
-#define TENTHS_DIGIT_START			11
-#define TENTHS_DIGIT_END			15
-#define HUNDRETHS_DIGIT_START		14
-#define HUNDRETHS_DIGIT_END			18
+#define SENSE_PERIOD_MIN_MS	7000	/* Time between temperature readings while the temperature changes */
+#define SENSE_PERIOD_MAX_MS	56000	/* Time between readings once it has been steady for a while */
+#define SENSE_BAND_CENTI	10		/* Readings within +-0.10 F of the reference count as steady */
+#define SENSE_SLOPE_CENTI	10		/* Changes faster than 0.10 F per minute go back to SENSE_PERIOD_MIN_MS */
+#define FIRST_SENSE_MS		3000	/* Start screen stays up this long */
+
+#define	WHOLE_DIGITS_X				8		/* Left edge of hundreds, tens and ones digits (byte column 1) */
+#define	FRACTION_DIGITS_X			96		/* Left edge of tenths and hundreths digits (byte column 12), right of the decimal point in "screen" */
 #define	DIGIT_UPDATE_Y_START		80
-#define	DIGIT_UPDATE_Y_END			115
-#define	DIGIT_UPDATE_X_START		0
-#define DIGIT_UPDATE_X_END			18
+#define	DIGIT_UPDATE_Y_END			115		/* Last row sent when a digit changed */
+
+#define	GRAPH_X						0		/* Trend graph region, empty in "screen" left of the logo */
+#define	GRAPH_Y						140
+#define	GRAPH_WIDTH					136		/* One column per reading, HISTORY_LENGTH readings */
+#define	GRAPH_HEIGHT				56
+#define	GRAPH_TEMP_MIN				7000	/* Temperature on the bottom row (hundredths of a degree F) */
+#define	GRAPH_TEMP_MAX				10500	/* Temperature on the top row */
 
 
-/***** Variables *****/
-volatile int alarmed;
-uint8_t buffer1[ARRAY_SIZE];		//Screen Update Buffer
-uint8_t val[5];
-uint8_t buttonPressed;				//Integer to count number of button presses
+/***** Variables (defined in Wearable_Temperature_Sensor_LP.c) *****/
+extern uint8_t val[5];
+extern volatile uint8_t buttonPressed;		//1 = low-power mode, toggled by the push-button
+extern ssd1608_t display;			//The EV kit panel
 
 /**
  *
  * @brief	This code showcases the deep-sleep mode capabilities of the MAX32660 microcontroller.
  * The code utilizes the MAX30205 temperauture sensor and the SSD1608, electronic ink display.
- * The program will run in active mode until the on-board push-button is pressed. After one push,
- * the micro will begin to enter deep sleep mode between temperature measurments and screen updates.
- * In order to return the system to active mode, the push-button should be pressed at least once
- * during the active mode tmeperature reading.
+ * Readings are taken by scheduler tasks (see LP_Scheduler.h): sense starts a one-shot conversion,
+ * read fetches the result MAX30205_CONVERSION_MS after the command is on the sensor, show draws it
+ * and refresh sends the changes to the display. The I2C transfers run by DMA and post the next
+ * task from their completion interrupt, so the CPU never waits in a loop. The time to the
+ * next reading adapts to how fast the temperature moves (see Adaptive_Sampler.h). Between tasks the
+ * micro sleeps until the next RTC alarm. The program starts in active mode (SLEEP between tasks).
+ * After one push of the on-board push-button it uses deep sleep instead; the next push returns it
+ * to active mode. The button also wakes the micro from deep sleep.
  *
  *		NOTE: Information on the power savings and future project updates can be found here:
  *		https://www.hackster.io/172196/human-body-temperature-to-e-ink-display-part-2-160940
@@ -125,81 +128,43 @@ uint8_t buttonPressed;				//Integer to count number of button presses
  *#include "tmr.h"
  *#include "pb.h"
  *#include "NVIC_table.h"
+ *#include "LP_Scheduler.h"
  *#include "MAX30205_Sensor.h"
  *#include "SSD1608_Display.h"
  *#include "Wearable_Temperature_Sensor_LP.h"
  *
- //Globals
- *extern uint8_t val[5];
- *extern uint8_t buttonPressed;
  *int main(void)
  *{
  *	printf("Initialization Begin\n");
  *	//Initialize SPI
- *	SPIinit();
+ *	SPIinit(&display);
  *
  *  //Initialize GPIO Pins
- *	 pinInit ();
+ *	 pinInit (&display);
+ *
+ *  //Pick the fastest bit rate display RAM writes read back correctly at
+ *  SPIlinkTune(&display);
  *
  *  StartScreen();
  * 
- *	NVIC_SetVector(RTC_IRQn, alarmHandler);
  *	SYS_ClockDisable(SYS_PERIPH_CLOCK_UART0);
  *
+ *  //Start the RTC the scheduler sleeps on
+ *  Sched_Init();
+ *
  *  //Initialize Sensor Addresses and pins
  *   MAX30205_I2CSetup();
  *
  *   //Set Sensor into Sleep Mode
  *   MAX30205_TempSenseSleep();
  *
- *   //Button Setup for entering/exiting sleep mode
+ *   //Button toggles between active and low-power mode, and wakes the micro from deep sleep
  *   PB_RegisterCallback(0, buttonHandler);
- *   TMR_Delay(MXC_TMR0, MSEC(3000), NULL);
- *
- *   //Main loop that continuously updates temperature on e-ink display
- *   while(1)
- *   {
- *   	printf("Returned to Active Mode\n");
- *   	MAX30205_OneShotSense();
- *
- *   	//Give time to make a new reading
- *   	TMR_Delay(MXC_TMR0, MSEC(50), NULL);
- *
- *   	//Convert to Fahrenheit and display new value on screen
- *   	double Celsius = MAX30205_TempRead();
- *   	double Fahrenheit = MAX30205_CtoF(Celsius);
- *   	TempValues(Fahrenheit);
- *   	BufferUpdate(val);
- *   	displayScreen();
- *
- *   	//User-requested low-power mode
- *   	if (buttonPressed == 1)
- *   	{
- *   		//Set trigger to wake up 32660 on RTC
- *			 LP_EnableRTCAlarmWakeup();
- *			 setTrigger(0);
+ *   LP_EnableGPIOWakeup(&pb_pin[0]);
  *
- *			 //pinSleep();
- *
- *			 //Prepare micro for deep-sleep and then enter low-power mode
- *			 LP_DisableBandGap();
- *			 LP_DisableVCorePORSignal();
- *			 LP_EnableRamRetReg();
- *			 LP_DisableBlockDetect();
- *			 LP_EnableFastWk();
- *			 LP_EnterDeepSleepMode();
- *   	}
- *
- *   	//Exit low-power mode
- *   	else if (buttonPressed >= 2){
- *   		buttonPressed = 0;
- *		}
- *
- *   	//Stay in active-mode
- *   	else{
- *   		TMR_Delay(MXC_TMR0, MSEC(6500), NULL);
- *   	}
- *   }
+ *   //Sense, read and refresh the display every 7 to 56 s, sleeping in between
+ *   TasksStart();
+ *   Sched_Run();
  *   return 0;
  *}
  *
@@ -209,29 +174,29 @@ uint8_t buttonPressed;				//Integer to count number of button presses
 /****** Functions *****/
 
 /**
- * @brief	Checks for RTC alarm flags and then clears them once set
+ * @brief	Toggles between active mode and low-power mode on every push-button press
  */
-void alarmHandler(void);
+void buttonHandler(void *pb);
 
 /**
- * @brief	Initialize RTC and prepare UART for deep-sleep
+ * @brief	Splits given number into each significant tens place (e.g hundreds, tens, ones, etc.)
  */
-void setTrigger(int waitForTrigger);
+void TempValues(int16_t centiF);
 
 /**
- * @brief	
+ * @brief	Builds the next frame from the pre-calculated template and digit font (LUT), see SSD1608_Stream.h. Returns 1 if a digit changed
  */
-void buttonHandler(void *pb);
+int BufferUpdate(uint8_t *pos);
 
 /**
- * @brief	Splits given number into each significant tens place (e.g hundreds, tens, ones, etc.)
+ * @brief	Stores a reading in the history and shifts it into the trend graph. Returns 1 if the graph changed
  */
-void TempValues(double temp);
+int TrendUpdate(int16_t centiF);
 
 /**
- * @brief	Updates buffer based on pre-calculated template and pre-calculated numbers (LUT)
+ * @brief	Registers the sense, convert, read, show and refresh tasks with the scheduler
  */
-void BufferUpdate(uint8_t *pos);
+void TasksStart(void);
 
 /**
  * @brief	Send a start screen to the display as temperature sensor is being configured
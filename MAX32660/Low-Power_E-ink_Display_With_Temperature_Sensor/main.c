@@ -66,26 +66,29 @@
  #include "tmr.h"
  #include "pb.h"
  #include "NVIC_table.h"
+ #include "LP_Scheduler.h"
  #include "MAX30205_Sensor.h"
  #include "SSD1608_Display.h"
  #include "Wearable_Temperature_Sensor_LP.h"
  
- //Globals
- extern uint8_t val[5];
- extern uint8_t buttonPressed;
  int main(void)
  {
  	printf("Initialization Begin\n");
  	//Initialize SPI
- 	SPIinit();
+ 	SPIinit(&display);
  
    //Initialize GPIO Pins
- 	 pinInit();
+ 	 pinInit(&display);
+
+   //Pick the fastest bit rate display RAM writes read back correctly at
+   SPIlinkTune(&display);
  
    StartScreen();
   
- 	NVIC_SetVector(RTC_IRQn, alarmHandler);
  	SYS_ClockDisable(SYS_PERIPH_CLOCK_UART0);
+
+   //Start the RTC the scheduler sleeps on
+   Sched_Init();
  
    //Initialize Sensor Addresses and pins
     MAX30205_I2CSetup();
@@ -93,54 +96,13 @@
    //Set Sensor into Sleep Mode
    MAX30205_TempSenseSleep();
  
-    //Button Setup for entering/exiting sleep mode
+    //Button toggles between active and low-power mode, and wakes the micro from deep sleep
     PB_RegisterCallback(0, buttonHandler);
-    TMR_Delay(MXC_TMR0, MSEC(3000), NULL);
- 
-    //Main loop that continuously updates temperature on e-ink display
-    while(1)
-    {
-    	printf("Returned to Active Mode\n");
-    	MAX30205_OneShotSense();
- 
-    	//Give time to make a new reading
-    	TMR_Delay(MXC_TMR0, MSEC(50), NULL);
- 
-    	//Convert to Fahrenheit and display new value on screen
-    	double Celsius = MAX30205_TempRead();
-    	double Fahrenheit = MAX30205_CtoF(Celsius);
-    	TempValues(Fahrenheit);
-    	BufferUpdate(val);
-    	displayScreen();
- 
-    	//User-requested low-power mode
-    	if (buttonPressed == 1)
-    	{
-    		//Set trigger to wake up 32660 on RTC
- 			 LP_EnableRTCAlarmWakeup();
- 			 setTrigger(0);
- 
- 			 //pinSleep();
- 
- 			 //Prepare micro for deep-sleep and then enter low-power mode
- 			 LP_DisableBandGap();
- 			 LP_DisableVCorePORSignal();
- 			 LP_EnableRamRetReg();
- 			 LP_DisableBlockDetect();
- 			 LP_EnableFastWk();
- 			 LP_EnterDeepSleepMode();
-    	}
- 
-    	//Exit low-power mode
-    	else if (buttonPressed >= 2){
-    		buttonPressed = 0;
- 		}
+    LP_EnableGPIOWakeup(&pb_pin[0]);
  
-    	//Stay in active-mode
-    	else{
-   		TMR_Delay(MXC_TMR0, MSEC(6500), NULL);
-    	}
-    }
+    //Sense, read and refresh the display every 7 to 56 s, sleeping in between
+    TasksStart();
+    Sched_Run();
     return 0;
  }
 
@@ -0,0 +1,117 @@
+/*
+ * Host benchmark for the per-frame bit reversal that BitMapTransfer used to do
+ * before the bitmaps were stored in panel bit order. Times three ways of
+ * producing one 5000-byte frame in panel order:
+ *
+ *   shift/add - the original eight shift, mask and add steps per byte
+ *   table     - a 256-entry lookup, the cheapest way to keep converting
+ *   stored    - the current driver: the frame is already in panel order and
+ *               is sent from where it is, so only a copy is timed as a floor
+ *
+ * The table is checked against the shift/add expression for every byte value.
+ *
+ * Build on the host (no SDK needed):
+ *
+ *   gcc -O2 -std=gnu99 bitrev_bench.c -o bitrev_bench
+ *
+ * Usage: ./bitrev_bench [iterations]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#define FRAME_SIZE			5000	//ARRAY_SIZE of the 1.54" panel
+#define BENCH_ITERATIONS	20000
+
+static uint8_t frame[FRAME_SIZE];
+static uint8_t out[FRAME_SIZE];
+static uint8_t reverse[256];
+
+/*
+ * @brief	The conversion BitMapTransfer did for every byte it sent
+ */
+static uint8_t shiftAdd(uint8_t d)
+{
+	return (((d>>7 & 0x01) + (d>>5 & 0x02) + (d>>3 & 0x04) + (d>>1 & 0x08) + (d<<1 & 0x10) + (d<<3 & 0x20) +(d<<5 & 0x40) + (d<<7 & 0x80)));
+}
+
+static void convertShiftAdd(void)
+{
+	for (int i = 0; i < FRAME_SIZE; i++)
+	{
+		out[i] = shiftAdd(frame[i]);
+	}
+}
+
+static void convertTable(void)
+{
+	for (int i = 0; i < FRAME_SIZE; i++)
+	{
+		out[i] = reverse[frame[i]];
+	}
+}
+
+static void convertStored(void)
+{
+	memcpy(out, frame, FRAME_SIZE);
+}
+
+/*
+ * @brief	Runs one conversion repeatedly and prints the time per frame and per byte
+ */
+static void bench(const char *name, void (*convert)(void), long iterations)
+{
+	struct timespec start, end;
+	uint32_t sum = 0;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (long i = 0; i < iterations; i++)
+	{
+		frame[i % FRAME_SIZE]++;				//Keeps the loop from being hoisted
+		convert();
+		sum += out[i % FRAME_SIZE];
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	double ns = ((end.tv_sec - start.tv_sec) * 1e9) + (end.tv_nsec - start.tv_nsec);
+	printf("%-10s %9.1f ns per frame  %6.3f ns per byte  (check %08x)\n", name, ns / iterations,
+			ns / ((double)iterations * FRAME_SIZE), (unsigned int)sum);
+}
+
+int main(int argc, char **argv)
+{
+	long iterations = (argc > 1) ? atol(argv[1]) : BENCH_ITERATIONS;
+
+	for (int v = 0; v < 256; v++)
+	{
+		uint8_t r = 0;
+		for (int b = 0; b < 8; b++)
+		{
+			if (v & (1 << b))
+			{
+				r |= 0x80 >> b;
+			}
+		}
+		reverse[v] = r;
+		if (shiftAdd(v) != r)
+		{
+			printf("shift/add reversal of 0x%02x is 0x%02x, expected 0x%02x\n", v, shiftAdd(v), r);
+			return 1;
+		}
+	}
+
+	srand(1);
+	for (int i = 0; i < FRAME_SIZE; i++)
+	{
+		frame[i] = rand();
+	}
+
+	printf("%ld frames of %d bytes\n", iterations, FRAME_SIZE);
+	bench("shift/add", convertShiftAdd, iterations);
+	bench("table", convertTable, iterations);
+	bench("stored", convertStored, iterations);
+	return 0;
+}
@@ -0,0 +1,108 @@
+/*
+ * Host benchmark for the SSD1608 drawing functions (WriteLine, drawThickLine,
+ * drawCircle, fillCircle). Draws a fixed scene into the framebuffer N times
+ * and prints the time per scene and the drawing rate in pixels per
+ * microsecond. Nothing is sent to a display; only the framebuffer code runs.
+ *
+ * The scene has lines in all eight octants, axis aligned lines, clipped lines,
+ * thick lines and outline / filled circles both on and partly off screen. The
+ * pixel count is the number of black pixels in the finished scene, so pixels
+ * drawn more than once only count once.
+ *
+ * Build on the host with the SDK headers on the include path. The SPI, GPIO
+ * and timer drivers are never called, so their symbols can stay unresolved:
+ *
+ *   gcc -O2 -std=gnu99 -I../SSD1608_Display -I<SDK>/Libraries/MAX32660PeriphDriver/Include \
+ *       -I<SDK>/Libraries/CMSIS/Device/Maxim/MAX32660/Include -I<SDK>/Libraries/CMSIS/Include \
+ *       -I<SDK>/Libraries/Boards/MAX32660/EvKit_V1/Include \
+ *       draw_bench.c ../SSD1608_Display/SSD1608_Display.c -o draw_bench -no-pie \
+ *       -Wl,--unresolved-symbols=ignore-all
+ *
+ * Usage: ./draw_bench [iterations]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "SSD1608_Display.h"
+
+#define BENCH_ITERATIONS	20000
+
+static uint8_t framebuffer[ARRAY_SIZE];
+static ssd1608_t display = SSD1608_EVKIT_PANEL(framebuffer);
+
+/*
+ * @brief	Draws the benchmark scene in black on a white framebuffer
+ */
+static void scene(ssd1608_t *disp)
+{
+	//Lines in every octant from the center
+	for (int16_t i = 0; i < 200; i += 25)
+	{
+		WriteLine(disp, 100, 100, i, 0, 0);
+		WriteLine(disp, 100, 100, 199, i, 0);
+		WriteLine(disp, 100, 100, 199 - i, 199, 0);
+		WriteLine(disp, 100, 100, 0, 199 - i, 0);
+	}
+
+	//Axis aligned and clipped lines
+	for (int16_t i = 0; i < 200; i += 20)
+	{
+		WriteLine(disp, 0, i, 199, i, 0);
+		WriteLine(disp, i, 0, i, 199, 0);
+	}
+	WriteLine(disp, -50, -30, 250, 260, 0);
+	WriteLine(disp, 230, -40, -60, 180, 0);
+
+	//Needles
+	drawThickLine(disp, 100, 100, 30, 40, 3, 0);
+	drawThickLine(disp, 100, 100, 170, 60, 5, 0);
+	drawThickLine(disp, 20, 190, 190, 150, 2, 0);
+
+	//Circles
+	for (uint8_t r = 10; r < 100; r += 15)
+	{
+		drawCircle(disp, 100, 100, r, 0);
+	}
+	drawCircle(disp, 0, 0, 60, 0);
+	fillCircle(disp, 100, 100, 8, 0);
+	fillCircle(disp, 40, 160, 30, 0);
+	fillCircle(disp, 195, 195, 25, 0);
+}
+
+/*
+ * @brief	Counts black pixels in the framebuffer
+ */
+static long blackPixels(const ssd1608_t *disp)
+{
+	long count = 0;
+	for (int i = 0; i < disp->rowBytes * disp->height; i++)
+	{
+		count += 8 - __builtin_popcount(disp->fb[i]);
+	}
+	return count;
+}
+
+int main(int argc, char **argv)
+{
+	long iterations = (argc > 1) ? atol(argv[1]) : BENCH_ITERATIONS;
+	struct timespec start, end;
+
+	//pinInit needs the GPIO drivers; the drawing code only uses the framebuffer fields
+	display.rowBytes = (display.width + 7) / 8;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (long i = 0; i < iterations; i++)
+	{
+		ClearBuffer(&display);
+		scene(&display);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	double us = ((end.tv_sec - start.tv_sec) * 1e6) + ((end.tv_nsec - start.tv_nsec) / 1e3);
+	printf("%ld scenes, %.3f us per scene\n", iterations, us / iterations);
+	long pixels = blackPixels(&display);
+	printf("%ld pixels per scene, %.1f pixels/us\n", pixels, (pixels * (double)iterations) / us);
+	return 0;
+}
@@ -0,0 +1,112 @@
+#!/usr/bin/env python3
+"""
+Compresses bitmap arrays from SSD1608_Display_LUT.h for RLEdecode and
+BitMapTransferRLE.
+
+Every 25-byte row is first XORed with the row above it (the first row with
+white, 0x00). Rows that repeat the one above therefore become 0x00 runs. The
+result is then stored as PackBits. A control byte n is followed by:
+  n = 0 .. 127    n + 1 literal bytes
+  n = 129 .. 255  one byte, repeated 257 - n times (2 to 128)
+  n = 128         nothing (never written here)
+
+Usage: python3 lut2rle.py <SSD1608_Display_LUT.h> <array_name> [<array_name> ...]
+"""
+
+import re
+import sys
+
+ROW_BYTES = 25
+
+
+def delta(data):
+    return bytes(b ^ (data[i - ROW_BYTES] if i >= ROW_BYTES else 0) for i, b in enumerate(data))
+
+
+def undelta(data):
+    out = bytearray(data)
+    for i in range(ROW_BYTES, len(out)):
+        out[i] ^= out[i - ROW_BYTES]
+    return bytes(out)
+
+
+def packbits(data):
+    out = bytearray()
+    i = 0
+    n = len(data)
+    while i < n:
+        run = 1
+        while i + run < n and run < 128 and data[i + run] == data[i]:
+            run += 1
+        if run >= 2:
+            out += bytes([257 - run, data[i]])
+            i += run
+            continue
+
+        # Literal run: stop where a repeat of two or more starts
+        start = i
+        i += 1
+        while i < n and i - start < 128:
+            if i + 1 < n and data[i] == data[i + 1]:
+                break
+            i += 1
+        out.append(i - start - 1)
+        out += data[start:i]
+    return bytes(out)
+
+
+def unpackbits(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        c = data[i]
+        i += 1
+        if c < 128:
+            out += data[i:i + c + 1]
+            i += c + 1
+        elif c > 128:
+            out += bytes([data[i]]) * (257 - c)
+            i += 1
+    return bytes(out)
+
+
+def read_array(text, name):
+    m = re.search(r'\b' + re.escape(name) + r'\s*\[[^\]]*\]\s*=\s*\{(.*?)\}', text, re.S)
+    if m is None:
+        sys.exit('array %s not found' % name)
+    return bytes(int(v, 16) for v in re.findall(r'0x[0-9a-fA-F]+', m.group(1)))
+
+
+def compress(raw):
+    data = packbits(delta(raw))
+    assert undelta(unpackbits(data)) == raw
+    return data
+
+
+def print_array(name, raw):
+    data = compress(raw)
+
+    print('//%s: %d bytes decoded, %d bytes stored' % (name, len(raw), len(data)))
+    print('#define %s_RLE_SIZE %d' % (name.upper(), len(data)))
+    print('const uint8_t %s_rle[%s_RLE_SIZE] = {' % (name, name.upper()))
+    lines = []
+    for i in range(0, len(data), 12):
+        lines.append('   ' + ', '.join('0x%02x' % b for b in data[i:i + 12]))
+    print(',\n'.join(lines))
+    print('};')
+
+
+def main():
+    if len(sys.argv) < 3:
+        sys.exit(__doc__)
+
+    with open(sys.argv[1]) as f:
+        text = f.read()
+
+    for name in sys.argv[2:]:
+        print_array(name, read_array(text, name))
+        print()
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,280 @@
+/*
+ * Host microbenchmark for the SSD1608 pixel engine. Draws one standard scene
+ * (lines in every octant, axis aligned lines, circles, horizontal spans and
+ * filled rectangles) twice:
+ *
+ *   reference - the original per-pixel code: drawPixel with round()/trunc()
+ *               and a mask rebuilt in a loop, WriteLine and drawCircle
+ *               plotting every pixel, spans and rectangles as pixel loops
+ *   engine    - the driver's WriteLine, drawCircle, drawHLine and fillRect
+ *
+ * Both framebuffers must be byte-identical. The time is reported per scene
+ * and per black pixel, in TSC cycles on x86 hosts and in nanoseconds
+ * elsewhere.
+ *
+ * Build on the host with the SDK headers on the include path. The SPI, GPIO
+ * and timer drivers are never called, so their symbols can stay unresolved:
+ *
+ *   gcc -O2 -std=gnu99 -I../SSD1608_Display -I<SDK>/Libraries/MAX32660PeriphDriver/Include \
+ *       -I<SDK>/Libraries/CMSIS/Device/Maxim/MAX32660/Include -I<SDK>/Libraries/CMSIS/Include \
+ *       -I<SDK>/Libraries/Boards/MAX32660/EvKit_V1/Include \
+ *       pixel_bench.c ../SSD1608_Display/SSD1608_Display.c -o pixel_bench -no-pie \
+ *       -Wl,--unresolved-symbols=ignore-all -lm
+ *
+ * Usage: ./pixel_bench [iterations]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "SSD1608_Display.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_UNIT		"cycles"
+#else
+#define BENCH_UNIT		"ns"
+#endif
+
+#define BENCH_ITERATIONS	5000
+
+static uint8_t framebuffer[ARRAY_SIZE];
+static ssd1608_t display = SSD1608_EVKIT_PANEL(framebuffer);
+static uint8_t reference[ARRAY_SIZE];
+
+/***** Reference (original per-pixel code) *****/
+
+static void refPixel(int16_t x, int16_t y, int color)
+{
+  x = round (x);
+  y = round (y);
+
+  if((x < 0) || (y < 0) || (x >= 200) || (y >= 200)) return;		//Out of Range
+
+  int value = x + (y * 200);		//Find index for specific pixel
+  int rem = value % 8;				//Which bit to modify with index (0-7)
+  int index = trunc(value/8);		//Finds the position in buffer1 to modify
+  int next;
+  int gate2 =0;
+  (void)color;						//Every caller draws black (0)
+  for(int i=0;i<8;i++)
+  {
+	  if(i == rem)				//Loop builds the mask most significant bit first
+	  {
+		  next = 0;
+	  }
+	  else
+	  {
+		  next = 1;
+	  }
+	  gate2 = (gate2 << 1) | next;
+  }
+  reference[index] = (reference[index] & gate2);
+}
+
+static void refLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, int color)
+{
+	int16_t steep = abs(y1 - y0) - abs(x1 - x0);
+	int16_t hold;
+	if (steep >= 1)
+	{
+		hold = x0; x0 = y0; y0 = hold;
+		hold = x1; x1 = y1; y1 = hold;
+	}
+	if (x0 > x1)
+	{
+		hold = x0; x0 = x1; x1 = hold;
+		hold = y1; y1 = y0; y0 = hold;
+	}
+
+	int16_t dx = x1 - x0;
+	int16_t dy = abs(y1 - y0);
+	int16_t err = dx / 2;
+	int16_t ystep = (y0 < y1) ? 1 : -1;
+
+	for (; x0<=x1; x0++)
+	{
+		if (steep >= 1)
+		{
+			refPixel(y0, x0, color);
+		}
+		else
+		{
+			refPixel(x0, y0, color);
+		}
+		err -= dy;
+		if (err < 0)
+		{
+			y0 += ystep;
+			err += dx;
+		}
+	}
+}
+
+static void refCircle(uint8_t x0, uint8_t y0, uint8_t r, uint8_t color)
+{
+	int16_t f = 1 - r;
+	int16_t ddF_x = 1;
+	int16_t ddF_y = -2 * r;
+	int16_t x = 0;
+	int16_t y = r;
+
+	refPixel(x0  , y0+r, color);
+	refPixel(x0  , y0-r, color);
+	refPixel(x0+r, y0  , color);
+	refPixel(x0-r, y0  , color);
+
+	while (x<y)
+	{
+		if (f >= 0)
+		{
+			y--;
+			ddF_y += 2;
+			f += ddF_y;
+		}
+		x++;
+		ddF_x += 2;
+		f += ddF_x;
+
+		refPixel(x0 + x, y0 + y, color);
+		refPixel(x0 - x, y0 + y, color);
+		refPixel(x0 + x, y0 - y, color);
+		refPixel(x0 - x, y0 - y, color);
+		refPixel(x0 + y, y0 + x, color);
+		refPixel(x0 - y, y0 + x, color);
+		refPixel(x0 + y, y0 - x, color);
+		refPixel(x0 - y, y0 - x, color);
+	}
+}
+
+static void refRect(int16_t x, int16_t y, int16_t w, int16_t h, int color)
+{
+	for (int16_t j = y; j < y + h; j++)
+	{
+		for (int16_t i = x; i < x + w; i++)
+		{
+			refPixel(i, j, color);
+		}
+	}
+}
+
+/***** Scene *****/
+
+typedef struct {
+	void (*line)(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+	void (*circle)(int16_t x0, int16_t y0, uint8_t r);
+	void (*rect)(int16_t x, int16_t y, int16_t w, int16_t h);
+} painter_t;
+
+static void refLineB(int16_t x0, int16_t y0, int16_t x1, int16_t y1) { refLine(x0, y0, x1, y1, 0); }
+static void refCircleB(int16_t x0, int16_t y0, uint8_t r) { refCircle(x0, y0, r, 0); }
+static void refRectB(int16_t x, int16_t y, int16_t w, int16_t h) { refRect(x, y, w, h, 0); }
+static void newLineB(int16_t x0, int16_t y0, int16_t x1, int16_t y1) { WriteLine(&display, x0, y0, x1, y1, 0); }
+static void newCircleB(int16_t x0, int16_t y0, uint8_t r) { drawCircle(&display, x0, y0, r, 0); }
+static void newRectB(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+	if (h == 1)
+	{
+		drawHLine(&display, x, y, w, 0);
+	}
+	else
+	{
+		fillRect(&display, x, y, w, h, 0);
+	}
+}
+
+static const painter_t refPainter = { refLineB, refCircleB, refRectB };
+static const painter_t newPainter = { newLineB, newCircleB, newRectB };
+
+/*
+ * @brief	Draws the standard scene in black. Coordinates stay on screen so the original unsigned line code draws them too
+ */
+static void scene(const painter_t *p)
+{
+	for (int16_t i = 0; i < 200; i += 25)
+	{
+		p->line(100, 100, i, 0);
+		p->line(100, 100, 199, i);
+		p->line(100, 100, 199 - i, 199);
+		p->line(100, 100, 0, 199 - i);
+	}
+	for (int16_t i = 0; i < 200; i += 20)
+	{
+		p->line(0, i, 199, i);
+		p->line(i, 0, i, 199);
+	}
+	for (uint8_t r = 10; r < 100; r += 15)
+	{
+		p->circle(100, 100, r);
+	}
+	p->circle(20, 20, 60);				//Partly off screen
+	for (int16_t y = 150; y < 160; y++)
+	{
+		p->rect(3 + y - 150, y, 120 + y - 150, 1);
+	}
+	p->rect(13, 170, 61, 20);
+	p->rect(130, 5, 64, 40);
+}
+
+static uint64_t now(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+	return __rdtsc();
+#else
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return ((uint64_t)t.tv_sec * 1000000000u) + t.tv_nsec;
+#endif
+}
+
+/*
+ * @brief	Draws the scene repeatedly into a white buffer and returns the average time per scene
+ */
+static double bench(const painter_t *p, uint8_t *fb, long iterations)
+{
+	uint64_t start = now();
+	for (long i = 0; i < iterations; i++)
+	{
+		memset(fb, 0xFF, ARRAY_SIZE);
+		scene(p);
+	}
+	return (double)(now() - start) / iterations;
+}
+
+int main(int argc, char **argv)
+{
+	long iterations = (argc > 1) ? atol(argv[1]) : BENCH_ITERATIONS;
+	long pixels = 0;
+
+	//pinInit needs the GPIO drivers; the drawing code only uses the framebuffer fields
+	display.rowBytes = (display.width + 7) / 8;
+
+	double ref = bench(&refPainter, reference, iterations);
+	double eng = bench(&newPainter, framebuffer, iterations);
+
+	for (int i = 0; i < ARRAY_SIZE; i++)
+	{
+		pixels += 8 - __builtin_popcount(framebuffer[i]);
+	}
+
+	printf("%ld scenes, %ld black pixels per scene\n", iterations, pixels);
+	printf("reference %10.0f %s per scene %7.2f %s per pixel\n", ref, BENCH_UNIT, ref / pixels, BENCH_UNIT);
+	printf("engine    %10.0f %s per scene %7.2f %s per pixel\n", eng, BENCH_UNIT, eng / pixels, BENCH_UNIT);
+
+	if (memcmp(reference, framebuffer, ARRAY_SIZE) != 0)
+	{
+		for (int i = 0; i < ARRAY_SIZE; i++)
+		{
+			if (reference[i] != framebuffer[i])
+			{
+				printf("framebuffers differ first at byte %d (row %d): %02x != %02x\n", i, i / ROW_BYTES, reference[i], framebuffer[i]);
+				break;
+			}
+		}
+		return 1;
+	}
+	printf("framebuffers are byte-identical\n");
+	return 0;
+}
@@ -0,0 +1,174 @@
+/*
+ * Host simulation of LP_Scheduler. Runs the real scheduler (LP_Scheduler.c)
+ * against a simulated RTC and reports the predicted duty cycle and average
+ * MCU current for a task set.
+ *
+ * The port functions (Sched_PortInit, Sched_Now, Sched_Seconds and
+ * Sched_PortSleep) are replaced here: time only moves while a task runs or
+ * the scheduler sleeps. Alarms are rounded up to the 1/256 s RTC tick like on
+ * the MAX32660. Each task has a time it keeps the CPU active and an optional
+ * time it then sleeps inside the task (e.g. displayScreen waiting for the
+ * panel in SLEEP, or an I2C transfer the task waits for with Sched_Expect). The
+ * default task set mirrors the project's sense / convert / read / show /
+ * refresh tasks at a fixed sense period (-p, e.g. SENSE_PERIOD_MIN_MS or
+ * SENSE_PERIOD_MAX_MS to bound the adaptive sampler). The times and currents
+ * below are estimates, replace them with figures measured on your board.
+ *
+ * Build on the host (only mxc_errors.h is needed from the SDK):
+ *
+ *   gcc -O2 -std=gnu99 -I../LP_Scheduler -I<SDK>/Libraries/MAX32660PeriphDriver/Include \
+ *       sched_sim.c ../LP_Scheduler/LP_Scheduler.c -o sched_sim
+ *
+ * Usage: ./sched_sim [-a] [-h hours] [-p sense_period_ms]
+ *   -a   active mode: hold a deep sleep lock, as before the first button press
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "LP_Scheduler.h"
+
+/***** Model *****/
+#define SIM_ACTIVE_UA		4800.0		//CPU running at 96 MHz
+#define SIM_SLEEP_UA		1500.0		//SLEEP, clocks running
+#define SIM_DEEPSLEEP_UA	3.0			//DEEPSLEEP, RTC running
+#define SIM_RTC_HZ			256
+
+typedef struct {
+	const char *name;
+	uint32_t period;			//ms, 0 = only run when chained
+	uint32_t first;				//ms until the first run
+	int chain;					//Task scheduled after this one runs (-1 = none)
+	uint32_t chainDelay;		//ms
+	double activeMs;			//CPU active per run
+	double sleepMs;				//SLEEP inside the task per run
+	unsigned long runs;
+} sim_task_t;
+
+static sim_task_t model[] = {
+	{ "sense",   7000, 3000,  1,  0, 0.1,   0.3, 0 },		//Start the one-shot command by DMA, SLEEP until it is written
+	{ "convert",    0,    0,  2, 50, 0.05,  0.0, 0 },		//Conversion: deep sleep when allowed
+	{ "read",       0,    0,  3,  0, 0.1,   0.5, 0 },		//Temperature register by DMA, SLEEP until it is in
+	{ "show",       0,    0,  4,  0, 1.4,   0.0, 0 },		//Digits and graph column
+	{ "refresh",    0,    0, -1,  0, 15.0, 320.0, 0 },		//Partial window over SPI, then the panel refresh
+};
+#define SIM_TASKS	(sizeof(model) / sizeof(model[0]))
+
+static sched_task_t tasks[SIM_TASKS];
+
+/***** Simulated Clock *****/
+static double sim_us;
+static double end_us;
+static double mode_us[3];			//Active, SLEEP, DEEPSLEEP
+static unsigned long sleeps[2];		//Scheduler sleeps per sched_mode_t
+
+void Sched_PortInit(void)
+{
+	sim_us = 0;
+}
+
+uint32_t Sched_Now(void)
+{
+	return (uint32_t)(sim_us / 1000);
+}
+
+uint32_t Sched_Seconds(void)
+{
+	return (uint32_t)(sim_us / 1000000);
+}
+
+void Sched_PortSleep(uint32_t ms, sched_mode_t mode)
+{
+	double us = end_us - sim_us;
+	if (ms != 0)
+	{
+		uint32_t ticks = ((ms * SIM_RTC_HZ) + 999) / 1000;
+		us = (ticks * 1000000.0) / SIM_RTC_HZ;
+	}
+	if (sim_us + us > end_us)
+	{
+		us = end_us - sim_us;
+	}
+
+	sleeps[mode]++;
+	mode_us[(mode == SCHED_DEEPSLEEP) ? 2 : 1] += us;
+	sim_us += us;
+}
+
+static void simRun(void *ctx)
+{
+	sim_task_t *t = ctx;
+
+	t->runs++;
+	sim_us += t->activeMs * 1000;
+	mode_us[0] += t->activeMs * 1000;
+	sim_us += t->sleepMs * 1000;
+	mode_us[1] += t->sleepMs * 1000;
+	if (t->chain >= 0)
+	{
+		Sched_RunIn(&tasks[t->chain], t->chainDelay);
+	}
+}
+
+int main(int argc, char **argv)
+{
+	double hours = 24;
+	int active = 0;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (!strcmp(argv[i], "-a"))
+		{
+			active = 1;
+		}
+		else if (!strcmp(argv[i], "-h") && i + 1 < argc)
+		{
+			hours = atof(argv[++i]);
+		}
+		else if (!strcmp(argv[i], "-p") && i + 1 < argc)
+		{
+			model[0].period = atoi(argv[++i]);
+		}
+		else
+		{
+			fprintf(stderr, "Usage: %s [-a] [-h hours] [-p sense_period_ms]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	end_us = hours * 3600e6;
+	Sched_Init();
+	if (active)
+	{
+		Sched_DeepSleepLock();
+	}
+	for (unsigned i = 0; i < SIM_TASKS; i++)
+	{
+		tasks[i].name = model[i].name;
+		tasks[i].run = simRun;
+		tasks[i].ctx = &model[i];
+		tasks[i].period = model[i].period;
+		Sched_Add(&tasks[i], model[i].first);
+	}
+
+	while (sim_us < end_us)
+	{
+		Sched_RunOnce();
+	}
+
+	double total = sim_us;
+	double charge = (mode_us[0] * SIM_ACTIVE_UA) + (mode_us[1] * SIM_SLEEP_UA) + (mode_us[2] * SIM_DEEPSLEEP_UA);
+
+	printf("Simulated %.1f h, %s mode, sense period %u ms\n\n", hours, active ? "active" : "low-power", (unsigned)model[0].period);
+	printf("%-10s %10s\n", "task", "runs");
+	for (unsigned i = 0; i < SIM_TASKS; i++)
+	{
+		printf("%-10s %10lu\n", model[i].name, model[i].runs);
+	}
+	printf("\n%-10s %12.3f s %8.4f %%\n", "active", mode_us[0] / 1e6, (100 * mode_us[0]) / total);
+	printf("%-10s %12.3f s %8.4f %%  (%lu scheduler sleeps)\n", "sleep", mode_us[1] / 1e6, (100 * mode_us[1]) / total, sleeps[SCHED_SLEEP]);
+	printf("%-10s %12.3f s %8.4f %%  (%lu scheduler sleeps)\n", "deep sleep", mode_us[2] / 1e6, (100 * mode_us[2]) / total, sleeps[SCHED_DEEPSLEEP]);
+	printf("\nduty cycle       %.4f %%\n", (100 * mode_us[0]) / total);
+	printf("average current  %.2f uA\n", charge / total);
+	return 0;
+}
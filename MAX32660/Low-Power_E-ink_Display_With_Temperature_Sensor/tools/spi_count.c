@@ -0,0 +1,87 @@
+/*
+ * Counts the SPI traffic of one full frame on the host, using the mock SPI
+ * backend in spi_mock.c. Compares the original push, which sent the
+ * framebuffer one byte per SPI_MasterTrans call, with BitMapTransfer and with
+ * a whole displayScreen (power-up, init sequence, RAM write and refresh).
+ *
+ * Build on the host with the SDK headers on the include path. spi_mock.c
+ * supplies the SPI, GPIO, timer and sleep drivers; nothing else is called:
+ *
+ *   gcc -O2 -std=gnu99 -I../SSD1608_Display -I<SDK>/Libraries/MAX32660PeriphDriver/Include \
+ *       -I<SDK>/Libraries/CMSIS/Device/Maxim/MAX32660/Include -I<SDK>/Libraries/CMSIS/Include \
+ *       -I<SDK>/Libraries/Boards/MAX32660/EvKit_V1/Include \
+ *       spi_count.c spi_mock.c ../SSD1608_Display/SSD1608_Display.c -o spi_count -no-pie \
+ *       -Wl,--unresolved-symbols=ignore-all
+ *
+ * Usage: ./spi_count
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "SSD1608_Display.h"
+#include "spi_mock.h"
+
+static uint8_t framebuffer[ARRAY_SIZE];
+static ssd1608_t display = SSD1608_EVKIT_PANEL(framebuffer);
+
+/*
+ * @brief	The framebuffer push as originally written: every byte bit-reversed and sent in its own transaction
+ */
+static void legacyTransfer(ssd1608_t *disp, const uint8_t *Design, int len)
+{
+	uint8_t buf[1];
+	for (int i = 0; i < len; i++)
+	{
+		buf[0] = (((Design[i]>>7 & 0x01) + (Design[i]>>5 & 0x02) + (Design[i]>>3 & 0x04) + (Design[i]>>1 & 0x08) + (Design[i]<<1 & 0x10) + (Design[i]<<3 & 0x20) +(Design[i]<<5 & 0x40) + (Design[i]<<7 & 0x80)));
+		SPItransfer(disp, buf, 1);
+	}
+}
+
+/*
+ * @brief	Addresses RAM from the top left and leaves DC high, ready for pixel data
+ */
+static void startRAM(ssd1608_t *disp)
+{
+	setRAM(disp, 0, 0);
+	writeRAM(disp);
+	GPIO_OutSet(&disp->dc);
+}
+
+int main(void)
+{
+	display.spi = SPI1A;			//Keeps the SPI0A registers out of the picture, see spi_mock.c
+	pinInit(&display);
+	SPIinit(&display);
+	ClearBuffer(&display);
+	powerUp(&display);
+
+	startRAM(&display);
+	spi_mock_reset();
+	legacyTransfer(&display, framebuffer, ARRAY_SIZE);
+	GPIO_OutSet(&display.cs);
+	spi_mock_print("per-byte push");
+	uint32_t legacy = spi_mock_stats.transactions;
+
+	startRAM(&display);
+	spi_mock_reset();
+	BitMapTransfer(&display, framebuffer, ARRAY_SIZE);
+	GPIO_OutSet(&display.cs);
+	spi_mock_print("BitMapTransfer");
+	uint32_t block = spi_mock_stats.transactions;
+
+	powerDown(&display);
+	spi_mock_reset();
+	SPIstatsReset();
+	displayScreen(&display);
+	spi_mock_print("displayScreen (full frame)");
+
+	if (spi_stats.transactions != spi_mock_stats.transactions || spi_stats.bytes != spi_mock_stats.bytes)
+	{
+		printf("spi_stats disagrees with the mock: %u transactions, %u bytes\n",
+				(unsigned int)spi_stats.transactions, (unsigned int)spi_stats.bytes);
+		return 1;
+	}
+
+	printf("frame push: %u transactions -> %u\n", (unsigned int)legacy, (unsigned int)block);
+	return 0;
+}
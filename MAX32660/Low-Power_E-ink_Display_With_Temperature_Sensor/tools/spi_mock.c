@@ -0,0 +1,283 @@
+/*
+ * Host stand-in for the SDK drivers SSD1608_Display.c calls, so the display
+ * driver can run off-target. Link it in place of the SDK libraries.
+ *
+ * - SPI_MasterTrans counts every transaction and byte and hands the bytes, with
+ *   the DC and CS levels they were sent with, to spi_mock_sink.
+ * - GPIO_OutSet / GPIO_OutClr / GPIO_OutGet keep the output levels in
+ *   spi_mock_pins and report changes to spi_mock_pin_hook. Inputs read 0, so
+ *   BUSY always reads idle.
+ * - No DMA channel is handed out, so every transfer goes through
+ *   SPI_MasterTrans. Use a panel on SPI1A: the SPI0A register block is never
+ *   touched then.
+ * - A BUSY_TMR wait expires the next time the core sleeps, and its time is
+ *   added to spi_mock_stats.ms.
+ *
+ * Build it together with the tool that uses it, see spi_count.c.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "SSD1608_Display.h"
+#include "spi_mock.h"
+
+#define MOCK_IRQS	64
+
+spi_mock_stats_t spi_mock_stats;
+uint32_t spi_mock_pins;
+void (*spi_mock_sink)(uint32_t pins, const uint8_t *data, unsigned int len);
+void (*spi_mock_pin_hook)(uint32_t old, uint32_t pins);
+
+static void (*vectors[MOCK_IRQS])(void);
+static uint32_t spi_hz = 1000000;
+static uint32_t tmr_ms;						//Length of the armed BUSY_TMR wait
+static int tmr_armed;
+static uint32_t sw_bytes;					//Byte count when XFER_TMR was started
+
+/*
+ * @brief	Zeroes spi_mock_stats
+ */
+void spi_mock_reset(void)
+{
+	memset(&spi_mock_stats, 0, sizeof(spi_mock_stats));
+}
+
+/*
+ * @brief	Prints spi_mock_stats on one line after a label
+ */
+void spi_mock_print(const char *label)
+{
+	printf("%-28s %6u transactions %7u bytes (%u command, %u data) %6u ms waited\n", label,
+			(unsigned int)spi_mock_stats.transactions, (unsigned int)spi_mock_stats.bytes,
+			(unsigned int)spi_mock_stats.commandBytes, (unsigned int)spi_mock_stats.dataBytes,
+			(unsigned int)spi_mock_stats.ms);
+	if (spi_mock_stats.deselected != 0)
+	{
+		printf("%-28s %6u transactions sent with CS high\n", "", (unsigned int)spi_mock_stats.deselected);
+	}
+}
+
+/***** SPI *****/
+
+int SPI_Init(spi_type spi_name, unsigned int mode, unsigned int freq)
+{
+	(void)spi_name;
+	(void)mode;
+	spi_hz = freq;
+	return E_NO_ERROR;
+}
+
+int SPI_MasterTrans(spi_type spi_name, spi_req_t *req)
+{
+	(void)spi_name;
+	spi_mock_stats.transactions++;
+	spi_mock_stats.bytes += req->len;
+	if (spi_mock_pins & DC_SEL)
+	{
+		spi_mock_stats.dataBytes += req->len;
+	}
+	else
+	{
+		spi_mock_stats.commandBytes += req->len;
+	}
+	if (spi_mock_pins & CS)
+	{
+		spi_mock_stats.deselected++;
+	}
+
+	if (req->tx_data != NULL && spi_mock_sink != NULL)
+	{
+		spi_mock_sink(spi_mock_pins, req->tx_data, req->len);
+	}
+	if (req->rx_data != NULL)
+	{
+		memset(req->rx_data, 0xFF, req->len);
+	}
+	return E_NO_ERROR;
+}
+
+int DMA_Init(void)
+{
+	return E_NO_ERROR;
+}
+
+int DMA_AcquireChannel(void)
+{
+	return E_NONE_AVAIL;
+}
+
+/***** GPIO *****/
+
+int GPIO_Config(const gpio_cfg_t *cfg)
+{
+	(void)cfg;
+	return E_NO_ERROR;
+}
+
+/*
+ * @brief	Sets the output levels and tells spi_mock_pin_hook about any change
+ */
+static void pinsWrite(uint32_t pins)
+{
+	uint32_t old = spi_mock_pins;
+
+	spi_mock_pins = pins;
+	if (pins != old && spi_mock_pin_hook != NULL)
+	{
+		spi_mock_pin_hook(old, pins);
+	}
+}
+
+void GPIO_OutSet(const gpio_cfg_t *cfg)
+{
+	pinsWrite(spi_mock_pins | cfg->mask);
+}
+
+void GPIO_OutClr(const gpio_cfg_t *cfg)
+{
+	pinsWrite(spi_mock_pins & ~cfg->mask);
+}
+
+uint32_t GPIO_OutGet(const gpio_cfg_t *cfg)
+{
+	return spi_mock_pins & cfg->mask;
+}
+
+uint32_t GPIO_InGet(const gpio_cfg_t *cfg)
+{
+	(void)cfg;
+	return 0;
+}
+
+int GPIO_IntConfig(const gpio_cfg_t *cfg, gpio_int_mode_t mode, gpio_int_pol_t pol)
+{
+	(void)cfg;
+	(void)mode;
+	(void)pol;
+	return E_NO_ERROR;
+}
+
+void GPIO_IntEnable(const gpio_cfg_t *cfg)
+{
+	(void)cfg;
+}
+
+void GPIO_IntDisable(const gpio_cfg_t *cfg)
+{
+	(void)cfg;
+}
+
+void GPIO_IntClr(const gpio_cfg_t *cfg)
+{
+	(void)cfg;
+}
+
+void GPIO_RegisterCallback(const gpio_cfg_t *cfg, gpio_callback_fn func, void *cbdata)
+{
+	(void)cfg;
+	(void)func;
+	(void)cbdata;
+}
+
+/***** Timers and interrupts *****/
+
+void NVIC_SetVector(IRQn_Type irqn, void (*irq_callback)(void))
+{
+	if ((int)irqn >= 0 && (int)irqn < MOCK_IRQS)
+	{
+		vectors[irqn] = irq_callback;
+	}
+}
+
+int TMR_Init(mxc_tmr_regs_t *tmr, tmr_pres_t pres, const sys_cfg_tmr_t *sys_cfg)
+{
+	(void)tmr;
+	(void)pres;
+	(void)sys_cfg;
+	return E_NO_ERROR;
+}
+
+int TMR_GetTicks(mxc_tmr_regs_t *tmr, uint32_t time, tmr_unit_t units, uint32_t *ticks)
+{
+	(void)tmr;
+	*ticks = (units == TMR_UNIT_MILLISEC) ? time : (time + 999) / 1000;		//Ticks are kept in milliseconds
+	return E_NO_ERROR;
+}
+
+int TMR_Config(mxc_tmr_regs_t *tmr, const tmr_cfg_t *cfg)
+{
+	if (tmr == BUSY_TMR)
+	{
+		tmr_ms = cfg->cmp_cnt;
+	}
+	return E_NO_ERROR;
+}
+
+void TMR_Enable(mxc_tmr_regs_t *tmr)
+{
+	if (tmr == BUSY_TMR)
+	{
+		tmr_armed = 1;
+	}
+}
+
+void TMR_Disable(mxc_tmr_regs_t *tmr)
+{
+	if (tmr == BUSY_TMR)
+	{
+		tmr_armed = 0;
+	}
+}
+
+void TMR_IntClear(mxc_tmr_regs_t *tmr)
+{
+	(void)tmr;
+}
+
+void TMR_SW_Start(mxc_tmr_regs_t *tmr, const sys_cfg_tmr_t *sys_cfg)
+{
+	(void)tmr;
+	(void)sys_cfg;
+	sw_bytes = spi_mock_stats.bytes;
+}
+
+unsigned int TMR_SW_Stop(mxc_tmr_regs_t *tmr)
+{
+	(void)tmr;
+	return (unsigned int)(((uint64_t)(spi_mock_stats.bytes - sw_bytes) * 8 * 1000000) / spi_hz);		//Wire time at the set rate
+}
+
+/*
+ * @brief	Sleeping lets the armed BUSY_TMR wait run out
+ */
+void LP_EnterSleepMode(void)
+{
+	spi_mock_stats.sleeps++;
+	if (tmr_armed)
+	{
+		tmr_armed = 0;
+		spi_mock_stats.ms += tmr_ms;
+		if (vectors[BUSY_TMR_IRQ] != NULL)
+		{
+			vectors[BUSY_TMR_IRQ]();
+		}
+	}
+}
+
+/***** Console *****/
+
+int UART_Busy(mxc_uart_regs_t *uart)
+{
+	(void)uart;
+	return 0;
+}
+
+int Console_Init(void)
+{
+	return E_NO_ERROR;
+}
+
+int Console_Shutdown(void)
+{
+	return E_NO_ERROR;
+}
@@ -0,0 +1,42 @@
+/*
+ * Host stand-in for the MAX32660 SPI, GPIO, timer and sleep drivers used by
+ * SSD1608_Display.c. See spi_mock.c.
+ */
+
+#ifndef SPI_MOCK_H_
+#define SPI_MOCK_H_
+
+#include <stdint.h>
+
+typedef struct {
+	uint32_t transactions;		//SPI_MasterTrans calls
+	uint32_t bytes;				//Bytes clocked out
+	uint32_t commandBytes;		//Bytes sent with DC low
+	uint32_t dataBytes;			//Bytes sent with DC high
+	uint32_t deselected;		//Transactions sent while CS was high (never seen by the panel)
+	uint32_t sleeps;			//LP_EnterSleepMode calls
+	uint32_t ms;				//Simulated time spent in timed waits
+} spi_mock_stats_t;
+
+extern spi_mock_stats_t spi_mock_stats;
+
+/* Output pin levels, one bit per pin of PORT_0 */
+extern uint32_t spi_mock_pins;
+
+/* Called for every transaction with the pin levels it was sent with (NULL = count only) */
+extern void (*spi_mock_sink)(uint32_t pins, const uint8_t *data, unsigned int len);
+
+/* Called whenever an output pin changes, with the levels before and after (NULL = not watched) */
+extern void (*spi_mock_pin_hook)(uint32_t old, uint32_t pins);
+
+/*
+ * @brief	Zeroes spi_mock_stats
+ */
+void spi_mock_reset(void);
+
+/*
+ * @brief	Prints spi_mock_stats on one line after a label
+ */
+void spi_mock_print(const char *label);
+
+#endif /* SPI_MOCK_H_ */
@@ -0,0 +1,457 @@
+/*
+ * Host emulator for the SSD1608 controller. Runs the display driver against
+ * the mock SPI backend in spi_mock.c and decodes the SPI / DC / CS stream the
+ * way the controller would: commands, RAM window and address counters, data
+ * entry mode, display RAM writes, LUT loads, deep sleep and resets.
+ *
+ * The controller's 200x200 display RAM is kept as a bitmap. Every master
+ * activation (0x20) is a frame: the RAM is what the panel shows, so it is
+ * compared with what the driver meant to show, the bytes and commands since
+ * the previous frame are printed, and with -o the RAM is dumped as a PBM.
+ *
+ * Frames driven:
+ *   1  full frame from the framebuffer
+ *   2  partial update of the dirty region
+ *   3  partial update of a window narrower than a row
+ *   4  full frame again after powerDown
+ *   5  streamed frame (full waveform) with rectangle, line and circle overlays
+ *   6  same overlays moved (partial waveform, RAM written twice)
+ *   7  streamed frame on the compressed "screen" background
+ *   8  only a band of rows of it (streamDisplayRows), the background decoded
+ *      from the top and the rows above the band dropped
+ *
+ * Build on the host with the SDK headers on the include path. spi_mock.c
+ * supplies the SPI, GPIO, timer and sleep drivers; nothing else is called:
+ *
+ *   gcc -O2 -std=gnu99 -I../SSD1608_Display -I../Wearable_Temperature_Sensor_LP -I<SDK>/Libraries/MAX32660PeriphDriver/Include \
+ *       -I<SDK>/Libraries/CMSIS/Device/Maxim/MAX32660/Include -I<SDK>/Libraries/CMSIS/Include \
+ *       -I<SDK>/Libraries/Boards/MAX32660/EvKit_V1/Include \
+ *       ssd1608_emu.c spi_mock.c ../SSD1608_Display/SSD1608_Display.c ../SSD1608_Display/SSD1608_Stream.c \
+ *       -o ssd1608_emu -no-pie -Wl,--unresolved-symbols=ignore-all
+ *
+ * Usage: ./ssd1608_emu [-o prefix]		(writes prefix001.pbm, prefix002.pbm, ...)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "SSD1608_Display.h"
+#include "SSD1608_Stream.h"
+#include "SSD1608_Display_LUT.h"
+#include "spi_mock.h"
+
+#define EMU_ROW_BYTES	ROW_BYTES
+#define EMU_ROWS		SCREEN_HEIGHT
+#define EMU_MAX_ARGS	32
+
+/***** Controller Model *****/
+typedef struct {
+	uint8_t ram[EMU_ROWS][EMU_ROW_BYTES];
+	int powered;				//EN high
+	int sleeping;				//Deep sleep entered, only a hardware reset wakes it
+	int lutLoaded;
+
+	uint8_t cmd;				//Command the data bytes belong to (0 = none yet)
+	int argc;
+	uint8_t argv[EMU_MAX_ARGS];
+
+	uint16_t gates;				//Driver output control (0x01)
+	uint8_t mode;				//Data entry mode (0x11)
+	uint8_t xs, xe;				//RAM window (0x44)
+	uint16_t ys, ye;			//RAM window (0x45)
+	uint8_t x;					//RAM address counters (0x4E, 0x4F)
+	uint16_t y;
+
+	/* Counters for the frame being built */
+	uint32_t commands;
+	uint32_t ramBytes;
+	uint32_t otherBytes;
+	uint32_t lutLoads;
+
+	/* Problems seen, over the whole run */
+	uint32_t outside;			//RAM bytes written outside 200x200
+	uint32_t orphanData;		//Data bytes before any command
+	uint32_t whileAsleep;		//Bytes sent during deep sleep or with the supply off
+	uint32_t noLut;				//Master activations without a LUT
+} emu_t;
+
+static emu_t emu;
+static int frames;
+static const char *pbm_prefix;
+
+/*
+ * @brief	Register values after a reset. Display RAM is left alone
+ */
+static void emuReset(void)
+{
+	emu.sleeping = 0;
+	emu.lutLoaded = 0;
+	emu.cmd = 0;
+	emu.argc = 0;
+	emu.gates = 0;
+	emu.mode = 0x03;
+	emu.xs = 0;
+	emu.xe = EMU_ROW_BYTES - 1;
+	emu.ys = 0;
+	emu.ye = EMU_ROWS - 1;
+	emu.x = 0;
+	emu.y = 0;
+}
+
+/*
+ * @brief	Moves the address counters on by one byte as the data entry mode says, wrapping inside the window
+ */
+static void emuAdvance(void)
+{
+	int xInc = emu.mode & 0x01;
+	int yInc = emu.mode & 0x02;
+	int yFirst = emu.mode & 0x04;
+	int carry = 0;
+
+	if (!yFirst)
+	{
+		if (xInc) { if (emu.x >= emu.xe) { emu.x = emu.xs; carry = 1; } else emu.x++; }
+		else { if (emu.x <= emu.xs) { emu.x = emu.xe; carry = 1; } else emu.x--; }
+		if (carry)
+		{
+			if (yInc) emu.y = (emu.y >= emu.ye) ? emu.ys : emu.y + 1;
+			else emu.y = (emu.y <= emu.ys) ? emu.ye : emu.y - 1;
+		}
+	}
+	else
+	{
+		if (yInc) { if (emu.y >= emu.ye) { emu.y = emu.ys; carry = 1; } else emu.y++; }
+		else { if (emu.y <= emu.ys) { emu.y = emu.ye; carry = 1; } else emu.y--; }
+		if (carry)
+		{
+			if (xInc) emu.x = (emu.x >= emu.xe) ? emu.xs : emu.x + 1;
+			else emu.x = (emu.x <= emu.xs) ? emu.xe : emu.x - 1;
+		}
+	}
+}
+
+/*
+ * @brief	Writes the RAM contents as a binary PBM (1 = black, so the panel's bits are inverted)
+ */
+static void emuDump(int frame)
+{
+	char name[256];
+	FILE *f;
+
+	snprintf(name, sizeof(name), "%s%03d.pbm", pbm_prefix, frame);
+	f = fopen(name, "wb");
+	if (f == NULL)
+	{
+		perror(name);
+		return;
+	}
+	fprintf(f, "P4\n%d %d\n", EMU_ROW_BYTES * 8, EMU_ROWS);
+	for (int y = 0; y < EMU_ROWS; y++)
+	{
+		for (int x = 0; x < EMU_ROW_BYTES; x++)
+		{
+			fputc(emu.ram[y][x] ^ 0xFF, f);
+		}
+	}
+	fclose(f);
+}
+
+/*
+ * @brief	Master activation -- the panel now shows display RAM
+ */
+static void emuFrame(void)
+{
+	frames++;
+	if (!emu.lutLoaded)
+	{
+		emu.noLut++;
+	}
+	printf("frame %d: %4u commands %5u RAM bytes %4u other bytes %u LUT loads\n", frames,
+			(unsigned int)emu.commands, (unsigned int)emu.ramBytes, (unsigned int)emu.otherBytes, (unsigned int)emu.lutLoads);
+	if (pbm_prefix != NULL)
+	{
+		emuDump(frames);
+	}
+	emu.commands = 0;
+	emu.ramBytes = 0;
+	emu.otherBytes = 0;
+	emu.lutLoads = 0;
+}
+
+/*
+ * @brief	Command byte (DC low). Commands without parameters act here
+ */
+static void emuCommand(uint8_t cmd)
+{
+	emu.cmd = cmd;
+	emu.argc = 0;
+	emu.commands++;
+
+	switch (cmd)
+	{
+	case SSD1608_SW_RESET:
+		emuReset();
+		break;
+
+	case SSD1608_MASTER_ACTIVATE:
+		emuFrame();
+		break;
+	}
+}
+
+/*
+ * @brief	Data byte (DC high) for the current command
+ */
+static void emuData(uint8_t d)
+{
+	if (emu.cmd == 0)
+	{
+		emu.orphanData++;
+		return;
+	}
+
+	if (emu.cmd == SSD1608_WRITE_RAM)
+	{
+		emu.ramBytes++;
+		if (emu.x < EMU_ROW_BYTES && emu.y < EMU_ROWS)
+		{
+			emu.ram[emu.y][emu.x] = d;
+		}
+		else
+		{
+			emu.outside++;
+		}
+		emuAdvance();
+		return;
+	}
+
+	emu.otherBytes++;
+	if (emu.argc < EMU_MAX_ARGS)
+	{
+		emu.argv[emu.argc] = d;
+	}
+	emu.argc++;
+
+	switch (emu.cmd)
+	{
+	case SSD1608_DRIVER_CONTROL:
+		if (emu.argc == 2) emu.gates = (emu.argv[0] | (emu.argv[1] << 8)) + 1;
+		break;
+	case SSD1608_DATA_MODE:
+		if (emu.argc == 1) emu.mode = d & 0x07;
+		break;
+	case SSD1608_SET_RAMXPOS:
+		if (emu.argc == 1) emu.xs = d;
+		if (emu.argc == 2) emu.xe = d;
+		break;
+	case SSD1608_SET_RAMYPOS:
+		if (emu.argc == 2) emu.ys = emu.argv[0] | (d << 8);
+		if (emu.argc == 4) emu.ye = emu.argv[2] | (d << 8);
+		break;
+	case SSD1608_SET_RAMXCOUNT:
+		if (emu.argc == 1) emu.x = d;
+		break;
+	case SSD1608_SET_RAMYCOUNT:
+		if (emu.argc == 1) emu.y = d;
+		if (emu.argc == 2) emu.y = emu.argv[0] | (d << 8);
+		break;
+	case SSD1608_WRITE_LUT:
+		if (emu.argc == 30)
+		{
+			emu.lutLoaded = 1;
+			emu.lutLoads++;
+		}
+		break;
+	case SSD1608_DEEP_SLEEP:
+		if (emu.argc == 1 && (d & 0x01)) emu.sleeping = 1;
+		break;
+	}
+}
+
+/*
+ * @brief	spi_mock_sink: bytes clocked out while CS is low reach the controller
+ */
+static void emuSink(uint32_t pins, const uint8_t *data, unsigned int len)
+{
+	if (pins & CS)
+	{
+		return;
+	}
+	if (!emu.powered || emu.sleeping)
+	{
+		emu.whileAsleep += len;
+		return;
+	}
+
+	for (unsigned int i = 0; i < len; i++)
+	{
+		if (pins & DC_SEL)
+		{
+			emuData(data[i]);
+		}
+		else
+		{
+			emuCommand(data[i]);
+		}
+	}
+}
+
+/*
+ * @brief	spi_mock_pin_hook: supply and reset pins
+ */
+static void emuPins(uint32_t old, uint32_t pins)
+{
+	if ((old & EN) && !(pins & EN))
+	{
+		emu.powered = 0;
+		memset(emu.ram, 0x5A, sizeof(emu.ram));		//RAM is lost with the supply
+	}
+	if (!(old & EN) && (pins & EN))
+	{
+		emu.powered = 1;
+		emuReset();
+	}
+	if ((old & RST) && !(pins & RST))
+	{
+		emuReset();
+	}
+}
+
+/***** Driver Under Test *****/
+static uint8_t framebuffer[ARRAY_SIZE];
+static ssd1608_t display = SSD1608_EVKIT_PANEL(framebuffer);
+
+static uint8_t expected[ARRAY_SIZE];
+static ssd1608_t scratch = SSD1608_EVKIT_PANEL(expected);		//Drawn into directly, never sent
+static uint8_t white[ARRAY_SIZE];
+static int failures;
+
+/*
+ * @brief	Compares display RAM with what the frame should show
+ */
+static void check(const char *what, const uint8_t *want)
+{
+	for (int y = 0; y < EMU_ROWS; y++)
+	{
+		for (int x = 0; x < EMU_ROW_BYTES; x++)
+		{
+			if (emu.ram[y][x] != want[y * EMU_ROW_BYTES + x])
+			{
+				printf("  %s: RAM differs at row %d byte %d: %02x, expected %02x\n", what, y, x, emu.ram[y][x], want[y * EMU_ROW_BYTES + x]);
+				failures++;
+				return;
+			}
+		}
+	}
+	printf("  %s: RAM matches\n", what);
+}
+
+/*
+ * @brief	Draws the test scene into a framebuffer panel
+ */
+static void scene(ssd1608_t *disp)
+{
+	for (int16_t i = 0; i < 200; i += 40)
+	{
+		WriteLine(disp, 100, 100, i, 0, 0);
+		WriteLine(disp, 100, 100, 199, i, 0);
+	}
+	drawCircle(disp, 100, 100, 60, 0);
+	fillCircle(disp, 40, 160, 25, 0);
+	fillRect(disp, 130, 150, 50, 30, 0);
+}
+
+/*
+ * @brief	The same streamed frame drawn into the scratch framebuffer
+ */
+static void streamScene(int16_t dx)
+{
+	streamBackground(white, 0);
+	streamAddRect(10 + dx, 20, 70, 15, 0);
+	streamAddLine(0, 199, 199 - dx, 50, 0);
+	streamAddLine(20 + dx, 10, 60 + dx, 190, 0);
+	streamAddCircle(120 - dx, 110, 45, 0, 0);
+	streamAddCircle(190, 10 + dx, 37, 0, 1);			//Partly off screen
+
+	memcpy(expected, white, ARRAY_SIZE);
+	fillRect(&scratch, 10 + dx, 20, 70, 15, 0);
+	WriteLine(&scratch, 0, 199, 199 - dx, 50, 0);
+	WriteLine(&scratch, 20 + dx, 10, 60 + dx, 190, 0);
+	drawCircle(&scratch, 120 - dx, 110, 45, 0);
+	fillCircle(&scratch, 190, 10 + dx, 37, 0);
+}
+
+/*
+ * @brief	A rectangle over the compressed "screen" background, streamed and drawn into the scratch framebuffer
+ */
+static void bandScene(int16_t y)
+{
+	streamBackground(screen_rle, SCREEN_RLE_SIZE);
+	streamAddRect(30, y, 100, 20, 0);
+
+	RLEdecode(expected, screen_rle, SCREEN_RLE_SIZE, ARRAY_SIZE, ROW_BYTES);
+	fillRect(&scratch, 30, y, 100, 20, 0);
+}
+
+int main(int argc, char **argv)
+{
+	if (argc == 3 && strcmp(argv[1], "-o") == 0)
+	{
+		pbm_prefix = argv[2];
+	}
+
+	spi_mock_sink = emuSink;
+	spi_mock_pin_hook = emuPins;
+	memset(emu.ram, 0x5A, sizeof(emu.ram));
+	memset(white, 0xFF, sizeof(white));
+	scratch.rowBytes = ROW_BYTES;
+
+	display.spi = SPI1A;			//Keeps the SPI0A registers out of the picture, see spi_mock.c
+	pinInit(&display);
+	SPIinit(&display);
+
+	ClearBuffer(&display);
+	scene(&display);
+	displayScreen(&display);
+	check("full frame", framebuffer);
+
+	fillRect(&display, 20, 30, 40, 12, 0);
+	displayScreen(&display);
+	check("dirty region", framebuffer);
+
+	drawHLine(&display, 0, 190, 200, 0);
+	displayRegion(&display, 40, 185, 90, 195);		//Only part of the new line is sent
+	memcpy(expected, framebuffer, ARRAY_SIZE);
+	drawHLine(&scratch, 0, 190, 200, 1);
+	drawHLine(&scratch, 40, 190, 56, 0);			//Window is rounded out to bytes 5 - 11
+	check("window", expected);
+
+	powerDown(&display);
+	displayScreen(&display);
+	check("after powerDown", framebuffer);
+
+	streamScene(0);
+	streamDisplay(&display, 0);
+	check("streamed, full waveform", expected);
+
+	streamScene(30);
+	streamDisplay(&display, 0);
+	check("streamed, partial waveform", expected);
+
+	bandScene(85);
+	streamDisplay(&display, 0);
+	check("streamed, compressed background", expected);
+
+	bandScene(105);
+	streamDisplayRows(&display, 80, 130, 0);		//Both positions of the rectangle
+	check("streamed band", expected);
+
+	printf("%d frames, gate lines set to %u\n", frames, (unsigned int)emu.gates);
+	if (emu.outside || emu.orphanData || emu.whileAsleep || emu.noLut || spi_mock_stats.deselected)
+	{
+		printf("%u bytes outside RAM, %u data bytes without a command, %u bytes while asleep or unpowered, %u frames without a LUT\n",
+				(unsigned int)emu.outside, (unsigned int)emu.orphanData, (unsigned int)emu.whileAsleep, (unsigned int)emu.noLut);
+		failures++;
+	}
+	return (failures != 0);
+}
@@ -0,0 +1,209 @@
+/*
+ * Host check and benchmark for the fixed-point temperature path
+ * (MAX30205_Q8, MAX30205_Q8ToCentiC, MAX30205_Q8ToCentiF and TempValues).
+ *
+ * Every one of the 65536 register codes is converted both ways and compared:
+ *   double:  the original MAX30205_TempCalc loop (pow per fraction bit),
+ *            MAX30205_CtoF and the trunc() based TempValues, copied below
+ *   integer: the project's fixed-point functions
+ * The double reference reads the register as two's complement with all eight
+ * fraction bits. The original loop read the MSB as unsigned and skipped the
+ * 1/256 bit; those codes are counted separately.
+ *
+ * A difference is only accepted where the exact result is a whole number of
+ * hundredths and the double path came out one hundredth low (e.g. 33.80 F is
+ * 33.799999... as a double and truncates to 33.79). Anything else fails.
+ *
+ * The benchmark reports cycles per conversion (rdtsc on x86, else ns). On the
+ * MAX32660, time the same loops with the DWT cycle counter.
+ *
+ * Build on the host with the SDK headers on the include path; the I2C, SPI and
+ * RTC drivers are never called, so their symbols can stay unresolved:
+ *
+ *   gcc -O2 -std=gnu99 -I../MAX30205_Sensor -I../Wearable_Temperature_Sensor_LP -I../SSD1608_Display \
+ *       -I../LP_Scheduler -I<SDK include paths, see draw_bench.c> \
+ *       temp_fixed_check.c ../MAX30205_Sensor/MAX30205_Sensor.c \
+ *       ../Wearable_Temperature_Sensor_LP/Wearable_Temperature_Sensor_LP.c \
+ *       -o temp_fixed_check -lm -no-pie -Wl,--unresolved-symbols=ignore-all
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "MAX30205_Sensor.h"
+#include "Wearable_Temperature_Sensor_LP.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_UNIT	"cycles"
+static uint64_t benchClock(void) { return __rdtsc(); }
+#else
+#define BENCH_UNIT	"ns"
+static uint64_t benchClock(void)
+{
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (t.tv_sec * 1000000000ull) + t.tv_nsec;
+}
+#endif
+
+#define BENCH_ROUNDS	20
+
+/***** Double Path (as before the fixed-point change) *****/
+
+static double refTempCalc(const uint8_t *data, int fixed)
+{
+	double Celsius = fixed ? (int8_t)data[0] : data[0];
+	int val;
+	double power = -1;
+	for(int j=7;j>=(fixed ? 0 : 1);j--){
+		val = (data[1]>>j) & 1;
+		Celsius += val*(pow(2,power));
+		power--;
+	}
+	return(Celsius);
+}
+
+static double refCtoF(double Celsius)
+{
+	double temp;
+	temp = Celsius*9;
+	temp = temp/5;
+	temp += 32;
+	return(temp);
+}
+
+static void refTempValues(double temp, uint8_t *digits)
+{
+	int hold = temp/100;
+	int rem = trunc(hold);
+	digits[0] = rem;
+	hold = trunc(temp / 10);
+	rem = (hold % 10);
+	digits[1]=rem;
+	hold = trunc(temp);
+	rem = hold % 10;
+	digits[2]=rem;
+	hold = trunc(temp*10);
+	rem = hold % 10;
+	digits[3]=rem;
+	hold = trunc(temp*100);
+	rem = hold % 10;
+	digits[4]=rem;
+}
+
+/*
+ * @brief	Accepts the integer result if it matches, or if it is exact and the double result is one hundredth low
+ * @return     { 0 = same, 1 = double rounding error, -1 = mismatch }
+ */
+static int compare(int32_t fixed, int32_t ref, int exact)
+{
+	if (fixed == ref)
+	{
+		return 0;
+	}
+	if (exact && ref == fixed - ((fixed > 0) ? 1 : -1))
+	{
+		return 1;
+	}
+	return -1;
+}
+
+int main(void)
+{
+	long failures = 0, roundingC = 0, roundingF = 0, roundingDigits = 0, oldDecode = 0;
+
+	for (uint32_t code = 0; code < 65536; code++)
+	{
+		uint8_t data[2] = { code >> 8, code & 0xFF };
+		int16_t q8 = MAX30205_Q8(data);
+		double C = refTempCalc(data, 1);
+		double F = refCtoF(C);
+
+		if (refTempCalc(data, 0) != C)
+		{
+			oldDecode++;
+		}
+		if (C != MAX30205_TempCalc(data))
+		{
+			printf("%04x: MAX30205_TempCalc %f, expected %f\n", code, MAX30205_TempCalc(data), C);
+			failures++;
+		}
+
+		int r = compare(MAX30205_Q8ToCentiC(q8), (int32_t)trunc(C * 100), ((int32_t)q8 * 25) % 64 == 0);
+		if (r < 0)
+		{
+			printf("%04x: centi C %d, double %d\n", code, MAX30205_Q8ToCentiC(q8), (int)trunc(C * 100));
+			failures++;
+		}
+		roundingC += r > 0;
+
+		int exactF = ((int32_t)q8 * 45) % 64 == 0;
+		int16_t centiF = MAX30205_Q8ToCentiF(q8);
+		r = compare(centiF, (int32_t)trunc(F * 100), exactF);
+		if (r < 0)
+		{
+			printf("%04x: centi F %d, double %d\n", code, centiF, (int)trunc(F * 100));
+			failures++;
+		}
+		roundingF += r > 0;
+
+		if (F >= 0)		//The display shows no sign, TempValues clamps below 0
+		{
+			uint8_t digits[5];
+			refTempValues(F, digits);
+			TempValues(centiF);
+			if (memcmp(digits, val, sizeof(digits)))
+			{
+				if (r > 0)
+				{
+					roundingDigits++;
+				}
+				else
+				{
+					printf("%04x: digits %u%u%u.%u%u, double %u%u%u.%u%u\n", code, val[0], val[1], val[2], val[3], val[4],
+						   digits[0], digits[1], digits[2], digits[3], digits[4]);
+					failures++;
+				}
+			}
+		}
+	}
+
+	printf("65536 codes: %ld failures\n", failures);
+	printf("double one hundredth low on exact values: %ld (C), %ld (F), %ld digit sets\n", roundingC, roundingF, roundingDigits);
+	printf("codes the original decoding read differently (signed MSB, 1/256 bit): %ld\n\n", oldDecode);
+
+	//Benchmark: register bytes to display digits
+	volatile uint8_t sink = 0;
+	uint64_t start = benchClock();
+	for (int round = 0; round < BENCH_ROUNDS; round++)
+	{
+		for (uint32_t code = 0; code < 65536; code++)
+		{
+			uint8_t data[2] = { code >> 8, code & 0xFF };
+			uint8_t digits[5];
+			refTempValues(refCtoF(refTempCalc(data, 1)), digits);
+			sink += digits[4];
+		}
+	}
+	uint64_t doubleTime = benchClock() - start;
+
+	start = benchClock();
+	for (int round = 0; round < BENCH_ROUNDS; round++)
+	{
+		for (uint32_t code = 0; code < 65536; code++)
+		{
+			uint8_t data[2] = { code >> 8, code & 0xFF };
+			TempValues(MAX30205_Q8ToCentiF(MAX30205_Q8(data)));
+			sink += val[4];
+		}
+	}
+	uint64_t fixedTime = benchClock() - start;
+
+	double n = BENCH_ROUNDS * 65536.0;
+	printf("double path: %.1f %s per conversion\n", doubleTime / n, BENCH_UNIT);
+	printf("fixed point: %.1f %s per conversion\n", fixedTime / n, BENCH_UNIT);
+	return (failures != 0);
+}
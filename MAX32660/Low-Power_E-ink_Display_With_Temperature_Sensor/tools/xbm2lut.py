@@ -0,0 +1,51 @@
+#!/usr/bin/env python3
+"""
+Converts a GIMP XBM export into a C array for SSD1608_Display_LUT.h.
+
+GIMP writes XBM data least significant bit first (leftmost pixel in bit 0),
+while the SSD1608 expects the leftmost pixel in bit 7. The bits of every byte
+are reversed here once, so the firmware can send the array as is.
+
+With --rle the array is written compressed (see lut2rle.py), ready for
+RLEdecode or BitMapTransferRLE.
+
+Usage: python3 xbm2lut.py [--rle] <image.xbm> <array_name>
+"""
+
+import re
+import sys
+
+
+def reverse_bits(b):
+    return int('{:08b}'.format(b)[::-1], 2)
+
+
+def main():
+    args = sys.argv[1:]
+    rle = '--rle' in args
+    if rle:
+        args.remove('--rle')
+    if len(args) != 2:
+        sys.exit(__doc__)
+
+    with open(args[0]) as f:
+        text = f.read()
+
+    body = text[text.index('{') + 1:text.rindex('}')]
+    data = [reverse_bits(int(v, 16)) for v in re.findall(r'0x[0-9a-fA-F]+', body)]
+
+    if rle:
+        import lut2rle
+        lut2rle.print_array(args[1], bytes(data))
+        return
+
+    print('uint8_t %s[%d] = {' % (args[1], len(data)))
+    lines = []
+    for i in range(0, len(data), 12):
+        lines.append('   ' + ', '.join('0x%02x' % b for b in data[i:i + 12]))
+    print(',\n'.join(lines))
+    print('};')
+
+
+if __name__ == '__main__':
+    main()